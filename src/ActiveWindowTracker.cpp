@@ -0,0 +1,221 @@
+/*
+ * MouseCross - A crosshair overlay application for visually impaired users
+ * Copyright (C) 2025 Stefan Lohmaier <stefan@slohmaier.de>
+ *
+ * This file is part of MouseCross.
+ *
+ * MouseCross is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MouseCross is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with MouseCross. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Project website: https://slohmaier.de/mousecross
+ */
+
+#include "ActiveWindowTracker.h"
+#include <QCoreApplication>
+#include <QFile>
+
+#if defined(HAVE_X11) && defined(HAVE_XCB)
+#include "X11Support.h"
+#include <X11/Xlib.h>
+#include <X11/Xatom.h>
+#include <X11/Xutil.h>
+#include <xcb/xcb.h>
+#define ACTIVEWINDOW_X11
+#endif
+
+namespace {
+
+// Windows seen so far. Entries are dropped when their window is destroyed, the
+// limit only guards against window managers that never destroy anything.
+const int MaxCachedWindows = 128;
+
+}
+
+ActiveWindowTracker::ActiveWindowTracker(QObject *parent)
+    : QObject(parent)
+    , m_active(false)
+    , m_selectedRoot(false)
+    , m_activeWindow(0)
+    , m_activeWindowAtom(0)
+    , m_pidAtom(0)
+{
+}
+
+ActiveWindowTracker::~ActiveWindowTracker()
+{
+    stop();
+}
+
+void ActiveWindowTracker::start()
+{
+    if (m_active) return;
+    m_active = true;
+
+#ifdef ACTIVEWINDOW_X11
+    Display* dpy = X11Support::display();
+    if (!dpy) return;
+
+    QCoreApplication::instance()->installNativeEventFilter(this);
+    m_activeWindowAtom = XInternAtom(dpy, "_NET_ACTIVE_WINDOW", False);
+    m_pidAtom = XInternAtom(dpy, "_NET_WM_PID", False);
+
+    // Qt usually selected property changes on the root window already
+    m_selectedRoot = X11Support::selectEvents(X11Support::rootWindow(), PropertyChangeMask, true);
+    XFlush(dpy);
+
+    m_activeWindow = 0;
+    updateActiveWindow();
+#endif
+}
+
+void ActiveWindowTracker::stop()
+{
+    if (!m_active) return;
+    m_active = false;
+
+#ifdef ACTIVEWINDOW_X11
+    if (Display* dpy = X11Support::display()) {
+        QCoreApplication::instance()->removeNativeEventFilter(this);
+        clearCache();
+        if (m_selectedRoot) {
+            X11Support::selectEvents(X11Support::rootWindow(), PropertyChangeMask, false);
+        }
+        m_selectedRoot = false;
+        XFlush(dpy);
+    }
+#endif
+    m_activeWindow = 0;
+}
+
+void ActiveWindowTracker::clearCache()
+{
+#ifdef ACTIVEWINDOW_X11
+    for (auto it = m_windows.constBegin(); it != m_windows.constEnd(); ++it) {
+        if (it->selected) {
+            X11Support::selectEvents(it.key(), StructureNotifyMask, false);
+        }
+    }
+#endif
+    m_windows.clear();
+}
+
+void ActiveWindowTracker::updateActiveWindow()
+{
+#ifdef ACTIVEWINDOW_X11
+    Display* dpy = X11Support::display();
+    if (!dpy) return;
+
+    unsigned long active = 0;
+    Atom type = None;
+    int format = 0;
+    unsigned long count = 0;
+    unsigned long remaining = 0;
+    unsigned char* data = nullptr;
+    if (XGetWindowProperty(dpy, X11Support::rootWindow(), m_activeWindowAtom, 0, 1, False, XA_WINDOW,
+                           &type, &format, &count, &remaining, &data) == Success && data) {
+        if (type == XA_WINDOW && format == 32 && count == 1) {
+            active = *reinterpret_cast<unsigned long*>(data);
+        }
+        XFree(data);
+    }
+    if (active == m_activeWindow && active) return;
+    m_activeWindow = active;
+    emit activeWindowChanged(active);
+
+    auto cached = m_windows.constFind(active);
+    if (cached == m_windows.constEnd()) {
+        if (m_windows.size() >= MaxCachedWindows) {
+            clearCache();
+        }
+        // Window ids are reused, the DestroyNotify drops the entry before that happens.
+        // Qt already selects StructureNotifyMask on its own windows.
+        CachedWindow window;
+        window.names = namesOf(active);
+        window.selected = X11Support::selectEvents(active, StructureNotifyMask, true);
+        cached = m_windows.insert(active, window);
+    }
+    emit activeApplicationChanged(cached->names);
+#endif
+}
+
+QStringList ActiveWindowTracker::namesOf(unsigned long window) const
+{
+    QStringList names;
+#ifdef ACTIVEWINDOW_X11
+    Display* dpy = X11Support::display();
+    if (!dpy || !window) return names;
+
+    XClassHint hint = { nullptr, nullptr };
+    if (XGetClassHint(dpy, window, &hint)) {
+        if (hint.res_name) {
+            names.append(QString::fromLocal8Bit(hint.res_name).toLower());
+            XFree(hint.res_name);
+        }
+        if (hint.res_class) {
+            names.append(QString::fromLocal8Bit(hint.res_class).toLower());
+            XFree(hint.res_class);
+        }
+    }
+
+    // The process name covers applications with generic or missing WM_CLASS
+    Atom type = None;
+    int format = 0;
+    unsigned long count = 0;
+    unsigned long remaining = 0;
+    unsigned char* data = nullptr;
+    if (XGetWindowProperty(dpy, window, m_pidAtom, 0, 1, False, XA_CARDINAL,
+                           &type, &format, &count, &remaining, &data) == Success && data) {
+        if (type == XA_CARDINAL && format == 32 && count == 1) {
+            const unsigned long pid = *reinterpret_cast<unsigned long*>(data);
+            QFile comm(QStringLiteral("/proc/%1/comm").arg(pid));
+            if (comm.open(QIODevice::ReadOnly)) {
+                names.append(QString::fromLocal8Bit(comm.readAll()).trimmed().toLower());
+            }
+        }
+        XFree(data);
+    }
+    names.removeDuplicates();
+    names.removeAll(QString());
+#else
+    Q_UNUSED(window);
+#endif
+    return names;
+}
+
+bool ActiveWindowTracker::nativeEventFilter(const QByteArray& eventType, void* message, qintptr* result)
+{
+    Q_UNUSED(result);
+
+#ifdef ACTIVEWINDOW_X11
+    if (eventType != "xcb_generic_event_t") return false;
+
+    auto* event = static_cast<xcb_generic_event_t*>(message);
+    const uint8_t responseType = event->response_type & ~0x80;
+    if (responseType == XCB_PROPERTY_NOTIFY) {
+        auto* property = reinterpret_cast<xcb_property_notify_event_t*>(event);
+        if (property->window == X11Support::rootWindow() && property->atom == m_activeWindowAtom) {
+            updateActiveWindow();
+        }
+    } else if (responseType == XCB_DESTROY_NOTIFY) {
+        // The selection went away with the window, nothing to deselect
+        auto* destroy = reinterpret_cast<xcb_destroy_notify_event_t*>(event);
+        m_windows.remove(destroy->window);
+    }
+#else
+    Q_UNUSED(eventType);
+    Q_UNUSED(message);
+#endif
+
+    // Qt relies on these events as well
+    return false;
+}
@@ -0,0 +1,75 @@
+/*
+ * MouseCross - A crosshair overlay application for visually impaired users
+ * Copyright (C) 2025 Stefan Lohmaier <stefan@slohmaier.de>
+ *
+ * This file is part of MouseCross.
+ *
+ * MouseCross is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MouseCross is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with MouseCross. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Project website: https://slohmaier.de/mousecross
+ */
+
+#ifndef ACTIVEWINDOWTRACKER_H
+#define ACTIVEWINDOWTRACKER_H
+
+#include <QObject>
+#include <QAbstractNativeEventFilter>
+#include <QHash>
+#include <QStringList>
+
+// Follows the focused application through _NET_ACTIVE_WINDOW property events
+// and reports the names it can be matched by: the WM_CLASS instance and class
+// and the process name, all lower case. Names are cached per window until it is
+// destroyed, so switching back and forth costs no round trip to the X server.
+// The only watcher of _NET_ACTIVE_WINDOW, SessionStateMonitor follows its
+// activeWindowChanged() as well.
+class ActiveWindowTracker : public QObject, public QAbstractNativeEventFilter
+{
+    Q_OBJECT
+
+public:
+    explicit ActiveWindowTracker(QObject *parent = nullptr);
+    ~ActiveWindowTracker() override;
+
+    // Starts watching and reports the current application right away
+    void start();
+    void stop();
+    bool isActive() const { return m_active; }
+    unsigned long activeWindow() const { return m_activeWindow; }
+
+    bool nativeEventFilter(const QByteArray& eventType, void* message, qintptr* result) override;
+
+signals:
+    void activeWindowChanged(unsigned long window);
+    void activeApplicationChanged(const QStringList& names);
+
+private:
+    struct CachedWindow {
+        QStringList names;
+        bool selected = false; // StructureNotifyMask on the window was added by us
+    };
+
+    void updateActiveWindow();
+    QStringList namesOf(unsigned long window) const;
+    void clearCache();
+
+    bool m_active;
+    bool m_selectedRoot;
+    unsigned long m_activeWindow;
+    unsigned long m_activeWindowAtom;
+    unsigned long m_pidAtom;
+    QHash<unsigned long, CachedWindow> m_windows;
+};
+
+#endif // ACTIVEWINDOWTRACKER_H
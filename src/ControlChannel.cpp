@@ -0,0 +1,129 @@
+/*
+ * MouseCross - A crosshair overlay application for visually impaired users
+ * Copyright (C) 2025 Stefan Lohmaier <stefan@slohmaier.de>
+ *
+ * This file is part of MouseCross.
+ *
+ * MouseCross is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MouseCross is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with MouseCross. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Project website: https://slohmaier.de/mousecross
+ */
+
+#include "ControlChannel.h"
+#include <QLocalServer>
+#include <QLocalSocket>
+#include <QStandardPaths>
+#include <QElapsedTimer>
+#include <QDebug>
+
+namespace
+{
+    // Requests are short, anything longer is not a client of ours
+    const qint64 MaxRequestLength = 4096;
+}
+
+namespace ControlChannel
+{
+    QString serverName()
+    {
+#ifdef Q_OS_UNIX
+        // A name in /tmp could be taken by another user first, the runtime
+        // directory (XDG_RUNTIME_DIR on Linux) belongs to this user alone
+        const QString runtimeDir = QStandardPaths::writableLocation(QStandardPaths::RuntimeLocation);
+        if (!runtimeDir.isEmpty()) return runtimeDir + QStringLiteral("/mousecross-control");
+#endif
+        // One instance per user, the pipe is only accessible to that user
+        QString user = qEnvironmentVariable("USER");
+        if (user.isEmpty()) user = qEnvironmentVariable("USERNAME");
+        return QStringLiteral("MouseCross-Control-") + user;
+    }
+
+    bool send(const QString& request, QString* reply, int timeoutMs)
+    {
+        QElapsedTimer timer;
+        timer.start();
+
+        QLocalSocket socket;
+        socket.connectToServer(serverName());
+        if (!socket.waitForConnected(timeoutMs)) return false;
+
+        socket.write(request.toUtf8() + '\n');
+        socket.flush();
+        while (!socket.canReadLine()) {
+            const int remaining = timeoutMs - int(timer.elapsed());
+            if (remaining <= 0 || !socket.waitForReadyRead(remaining)) {
+                if (reply) *reply = QStringLiteral("error no answer");
+                return true;
+            }
+        }
+        if (reply) *reply = QString::fromUtf8(socket.readLine()).trimmed();
+        socket.disconnectFromServer();
+        return true;
+    }
+}
+
+ControlServer::ControlServer(QObject *parent)
+    : QObject(parent)
+    , m_server(new QLocalServer(this))
+{
+    m_server->setSocketOptions(QLocalServer::UserAccessOption);
+    connect(m_server, &QLocalServer::newConnection, this, &ControlServer::handleNewConnection);
+}
+
+bool ControlServer::listen()
+{
+    const QString name = ControlChannel::serverName();
+    if (m_server->listen(name)) return true;
+
+    // The caller holds the single instance lock, a socket left behind is from a crashed instance
+    if (m_server->serverError() == QAbstractSocket::AddressInUseError) {
+        QLocalServer::removeServer(name);
+        if (m_server->listen(name)) return true;
+    }
+    qWarning() << "Failed to listen for control commands:" << m_server->errorString();
+    return false;
+}
+
+void ControlServer::handleNewConnection()
+{
+    while (QLocalSocket* socket = m_server->nextPendingConnection()) {
+        connect(socket, &QLocalSocket::disconnected, socket, &QObject::deleteLater);
+        connect(socket, &QLocalSocket::readyRead, this, [this, socket]() { handleReadyRead(socket); });
+        // The request may have arrived with the connection
+        if (socket->bytesAvailable() > 0) handleReadyRead(socket);
+    }
+}
+
+void ControlServer::handleReadyRead(QLocalSocket* socket)
+{
+    while (socket->canReadLine()) {
+        const QString line = QString::fromUtf8(socket->readLine()).trimmed();
+        QStringList words = line.split(QLatin1Char(' '), Qt::SkipEmptyParts);
+        QString reply;
+        if (words.isEmpty()) {
+            reply = QStringLiteral("error empty request");
+        } else if (!m_handler) {
+            reply = QStringLiteral("error not ready");
+        } else {
+            const QString command = words.takeFirst().toLower();
+            reply = m_handler(command, words);
+        }
+        socket->write(reply.toUtf8() + '\n');
+    }
+    socket->flush();
+
+    if (socket->bytesAvailable() > MaxRequestLength) {
+        socket->abort();
+    }
+}
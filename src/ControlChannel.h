@@ -0,0 +1,68 @@
+/*
+ * MouseCross - A crosshair overlay application for visually impaired users
+ * Copyright (C) 2025 Stefan Lohmaier <stefan@slohmaier.de>
+ *
+ * This file is part of MouseCross.
+ *
+ * MouseCross is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MouseCross is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with MouseCross. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Project website: https://slohmaier.de/mousecross
+ */
+
+#ifndef CONTROLCHANNEL_H
+#define CONTROLCHANNEL_H
+
+#include <QObject>
+#include <QString>
+#include <QStringList>
+#include <functional>
+
+class QLocalServer;
+class QLocalSocket;
+
+// Line based command channel to the running instance over a per user local
+// socket. A request is one line of space separated words, e.g.
+//   toggle | show | hide | set crosshair/lineWidth=6 crosshair/color=#ff0000 | get stats
+// and every request is answered with one line starting with "ok" or "error".
+namespace ControlChannel
+{
+    QString serverName();
+
+    // Sends one request to the running instance and waits for the answer.
+    // Returns false when no instance is listening.
+    bool send(const QString& request, QString* reply, int timeoutMs = 1000);
+}
+
+class ControlServer : public QObject
+{
+    Q_OBJECT
+
+public:
+    // Returns the answer without the trailing newline
+    using Handler = std::function<QString(const QString& command, const QStringList& args)>;
+
+    explicit ControlServer(QObject *parent = nullptr);
+
+    void setHandler(Handler handler) { m_handler = std::move(handler); }
+    bool listen();
+
+private:
+    void handleNewConnection();
+    void handleReadyRead(QLocalSocket* socket);
+
+    QLocalServer* m_server;
+    Handler m_handler;
+};
+
+#endif // CONTROLCHANNEL_H
@@ -0,0 +1,272 @@
+/*
+ * MouseCross - A crosshair overlay application for visually impaired users
+ * Copyright (C) 2025 Stefan Lohmaier <stefan@slohmaier.de>
+ *
+ * This file is part of MouseCross.
+ *
+ * MouseCross is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MouseCross is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with MouseCross. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Project website: https://slohmaier.de/mousecross
+ */
+
+#include "CrosshairGeometry.h"
+#include <QPainter>
+#include <QtMath>
+#include <cmath>
+
+QPolygonF CrosshairGeometry::ArmGeometry::outline(double widthFactor) const
+{
+    QPointF direction = end - start;
+    double length = std::sqrt(direction.x() * direction.x() + direction.y() * direction.y());
+    if (length == 0) return QPolygonF();
+
+    // Perpendicular to the arm direction
+    QPointF normal(-direction.y() / length, direction.x() / length);
+    QPointF startOffset = normal * (startThickness * widthFactor / 2.0);
+    QPointF endOffset = normal * (endThickness * widthFactor / 2.0);
+
+    QPolygonF quad;
+    quad << start - startOffset << end - endOffset << end + endOffset << start + startOffset;
+    return quad;
+}
+
+QRectF CrosshairGeometry::ArmGeometry::closingLine() const
+{
+    return QRectF(start.x() - startThickness / 2.0, start.y() - startThickness / 2.0,
+                  startThickness, startThickness);
+}
+
+QRectF CrosshairGeometry::ArmGeometry::centerLine() const
+{
+    QRectF line = QRectF(start, end).normalized();
+    if (start.y() == end.y()) {
+        return QRectF(line.left(), start.y() - 0.5, line.width(), 1.0);
+    }
+    return QRectF(start.x() - 0.5, line.top(), 1.0, line.height());
+}
+
+QPointF CrosshairGeometry::ArmGeometry::towardsCenter() const
+{
+    QPointF delta = start - end;
+    double length = std::sqrt(delta.x() * delta.x() + delta.y() * delta.y());
+    if (length == 0) return QPointF();
+    return delta / length;
+}
+
+CrosshairGeometry::CrosshairGeometry(const CrosshairRenderer::Settings& settings, const QPoint& mousePos,
+                                     const QRect& screenGeometry, int baseThickness)
+{
+    const int x = mousePos.x();
+    const int y = mousePos.y();
+    const int offset = settings.offsetFromCursor;
+    const double endThickness = settings.solidArms ? baseThickness : baseThickness * settings.thicknessMultiplier;
+
+    m_arms[LeftArm] = { QPointF(x - offset, y), QPointF(screenGeometry.left(), y),
+                        double(baseThickness), endThickness, x - screenGeometry.left() };
+    m_arms[RightArm] = { QPointF(x + offset, y), QPointF(screenGeometry.right(), y),
+                         double(baseThickness), endThickness, screenGeometry.right() - x };
+    m_arms[TopArm] = { QPointF(x, y - offset), QPointF(x, screenGeometry.top()),
+                       double(baseThickness), endThickness, y - screenGeometry.top() };
+    m_arms[BottomArm] = { QPointF(x, y + offset), QPointF(x, screenGeometry.bottom()),
+                          double(baseThickness), endThickness, screenGeometry.bottom() - y };
+
+    if (settings.showArrows) {
+        buildShapes(settings, baseThickness, screenGeometry);
+    }
+}
+
+void CrosshairGeometry::buildShapes(const CrosshairRenderer::Settings& settings, int baseThickness,
+                                    const QRect& screenGeometry)
+{
+    for (int i = 0; i < ArmCount; ++i) {
+        const ArmGeometry& armGeometry = m_arms[i];
+        if (armGeometry.totalDistance <= 0 || armGeometry.start == armGeometry.end) continue;
+
+        for (double dist : shapeDistances(settings, baseThickness, armGeometry.totalDistance)) {
+            if (dist > armGeometry.totalDistance) continue;
+
+            // Same placement and sizing as the QPainter renderer
+            double progress = dist / armGeometry.totalDistance;
+            QPointF center(armGeometry.start.x() + static_cast<int>((armGeometry.end.x() - armGeometry.start.x()) * progress),
+                           armGeometry.start.y() + static_cast<int>((armGeometry.end.y() - armGeometry.start.y()) * progress));
+            double thicknessMultiplier = 1.0 + (settings.thicknessMultiplier - 1.0) * progress;
+            int radius = static_cast<int>(baseThickness * thicknessMultiplier) / 4;
+
+            QRectF shapeBounds(center.x() - radius, center.y() - radius, radius * 2, radius * 2);
+            if (radius > 0 && shapeBounds.intersects(screenGeometry)) {
+                m_shapes.append({ center, radius, static_cast<Arm>(i) });
+            }
+        }
+    }
+}
+
+QRectF CrosshairGeometry::armBounds(Arm arm) const
+{
+    const ArmGeometry& armGeometry = m_arms[arm];
+    QRectF bounds = armGeometry.outline().boundingRect().united(armGeometry.closingLine());
+    for (const ShapeInstance& shape : m_shapes) {
+        if (shape.arm != arm) continue;
+        // Arrows and rautes reach up to 1.3 radii from their center
+        double extent = shape.radius * 1.3 + 1.0;
+        bounds = bounds.united(QRectF(shape.center.x() - extent, shape.center.y() - extent, extent * 2, extent * 2));
+    }
+    return bounds;
+}
+
+void CrosshairGeometry::paintArm(QPainter& painter, Arm arm, const CrosshairRenderer::Settings& settings) const
+{
+    const ArmGeometry& armGeometry = m_arms[arm];
+
+    painter.setPen(Qt::NoPen);
+    painter.setBrush(settings.color);
+    painter.drawRect(armGeometry.closingLine());
+    paintArmBody(painter, armGeometry, settings);
+
+    for (const ShapeInstance& shape : m_shapes) {
+        if (shape.arm != arm) continue;
+        painter.drawPath(shapePath(settings.directionShape, shape.center, shape.radius, armGeometry.towardsCenter()));
+    }
+}
+
+void CrosshairGeometry::paintArmBody(QPainter& painter, const ArmGeometry& arm, const CrosshairRenderer::Settings& settings)
+{
+    painter.setPen(Qt::NoPen);
+    painter.setBrush(settings.color);
+    painter.drawPolygon(arm.outline());
+
+    // Inner contrasting line if not inverted
+    if (!settings.inverted && !settings.solidArms) {
+        int r, g, b;
+        settings.color.getRgb(&r, &g, &b);
+        painter.setBrush(QColor(255 - r, 255 - g, 255 - b));
+        painter.drawPolygon(arm.outline(0.5));
+        painter.setBrush(settings.color);
+    }
+
+    // Same colour as the shapes, so it makes no difference that it is drawn below them
+    painter.drawRect(arm.centerLine());
+}
+
+QRect CrosshairGeometry::horizontalBand() const
+{
+    const ArmGeometry& left = m_arms[LeftArm];
+    const ArmGeometry& right = m_arms[RightArm];
+    int halfHeight = qCeil(qMax(left.endThickness, left.startThickness) / 2.0) + 2;
+    int y = static_cast<int>(left.start.y());
+    return QRect(QPoint(static_cast<int>(left.end.x()), y - halfHeight),
+                 QPoint(static_cast<int>(right.end.x()), y + halfHeight));
+}
+
+QRect CrosshairGeometry::verticalBand() const
+{
+    const ArmGeometry& top = m_arms[TopArm];
+    const ArmGeometry& bottom = m_arms[BottomArm];
+    int halfWidth = qCeil(qMax(top.endThickness, top.startThickness) / 2.0) + 2;
+    int x = static_cast<int>(top.start.x());
+    return QRect(QPoint(x - halfWidth, static_cast<int>(top.end.y())),
+                 QPoint(x + halfWidth, static_cast<int>(bottom.end.y())));
+}
+
+std::vector<double> CrosshairGeometry::shapeDistances(const CrosshairRenderer::Settings& settings,
+                                                      int baseThickness, int totalDistance)
+{
+    std::vector<double> positions;
+    if (totalDistance <= 0) return positions;
+
+    // Calculate initial circle diameter at center (smallest size)
+    // Circle radius = currentThickness / 4, so diameter = currentThickness / 2
+    double baseDiameter = baseThickness / 2.0;
+    double initialSpacing = baseDiameter * 2.0;
+    double spacingMultiplier = 1.0 + (settings.circleSpacingIncrease / 100.0);
+
+    double currentDistance = initialSpacing;
+    const int stride = qMax(1, settings.shapeStride);
+    int index = 0;
+
+    // Generate positions from center toward edge with fixed progressive spacing
+    while (currentDistance < totalDistance * 1.2) {  // Go slightly beyond line end for edge cases
+        // Thinned out shapes keep the spacing of the full set, just skip some
+        if (index++ % stride == 0) {
+            positions.push_back(currentDistance);
+        }
+
+        double progress = currentDistance / totalDistance;
+        double thickMultiplier = 1.0 + (settings.thicknessMultiplier - 1.0) * progress;
+        double circleDiameter = (baseThickness * thickMultiplier) / 2.0;
+
+        // Next spacing is 2x the current circle diameter, compounded by the spacing setting
+        currentDistance += (circleDiameter * 2.0) * spacingMultiplier;
+        spacingMultiplier *= (1.0 + (settings.circleSpacingIncrease / 100.0));
+    }
+
+    return positions;
+}
+
+QPainterPath CrosshairGeometry::shapePath(CrosshairRenderer::DirectionShape shape, const QPointF& center,
+                                          int radius, const QPointF& towardsCenter)
+{
+    QPainterPath path;
+    const double cx = center.x();
+    const double cy = center.y();
+
+    switch (shape) {
+        case CrosshairRenderer::DirectionShape::Circle:
+            path.addEllipse(center, radius, radius);
+            break;
+
+        case CrosshairRenderer::DirectionShape::Arrow:
+        {
+            double arrowSize = radius * 2.0;
+            double nx = towardsCenter.x();
+            double ny = towardsCenter.y();
+            double perpX = -ny;
+            double perpY = nx;
+
+            QPolygonF arrow;
+            arrow << QPointF(cx + nx * arrowSize * 0.3, cy + ny * arrowSize * 0.3)
+                  << QPointF(cx - (nx * arrowSize * 0.5 - perpX * arrowSize * 0.6),
+                             cy - (ny * arrowSize * 0.5 - perpY * arrowSize * 0.6))
+                  << QPointF(cx - (nx * arrowSize * 0.5 + perpX * arrowSize * 0.6),
+                             cy - (ny * arrowSize * 0.5 + perpY * arrowSize * 0.6));
+            path.addPolygon(arrow);
+            path.closeSubpath();
+            break;
+        }
+
+        case CrosshairRenderer::DirectionShape::Cross:
+        {
+            int crossSize = static_cast<int>(radius * 1.2);
+            int lineWidth = static_cast<int>(radius * 0.6);
+            path.setFillRule(Qt::WindingFill);
+            path.addRect(QRectF(cx - crossSize, cy - lineWidth / 2, crossSize * 2, lineWidth));
+            path.addRect(QRectF(cx - lineWidth / 2, cy - crossSize, lineWidth, crossSize * 2));
+            break;
+        }
+
+        case CrosshairRenderer::DirectionShape::Raute:
+        {
+            int rauteSize = static_cast<int>(radius * 1.3);
+            QPolygonF diamond;
+            diamond << QPointF(cx, cy - rauteSize)
+                    << QPointF(cx + rauteSize, cy)
+                    << QPointF(cx, cy + rauteSize)
+                    << QPointF(cx - rauteSize, cy);
+            path.addPolygon(diamond);
+            path.closeSubpath();
+            break;
+        }
+    }
+
+    return path;
+}
@@ -0,0 +1,110 @@
+/*
+ * MouseCross - A crosshair overlay application for visually impaired users
+ * Copyright (C) 2025 Stefan Lohmaier <stefan@slohmaier.de>
+ *
+ * This file is part of MouseCross.
+ *
+ * MouseCross is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MouseCross is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with MouseCross. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Project website: https://slohmaier.de/mousecross
+ */
+
+#ifndef CROSSHAIRGEOMETRY_H
+#define CROSSHAIRGEOMETRY_H
+
+#include "CrosshairRenderer.h"
+#include <QPainterPath>
+#include <QPointF>
+#include <QPolygonF>
+#include <QRectF>
+#include <QVector>
+#include <vector>
+
+class QPainter;
+
+// Backend-independent description of one crosshair frame. Native renderers
+// translate this display list into their own primitives (trapezoids, XOR
+// polygons, buffers) so that every backend draws the same crosshair.
+class CrosshairGeometry
+{
+public:
+    enum Arm {
+        LeftArm = 0,
+        RightArm = 1,
+        TopArm = 2,
+        BottomArm = 3,
+        ArmCount = 4
+    };
+
+    struct ArmGeometry {
+        QPointF start;           // Arm start at the cursor offset
+        QPointF end;             // Arm end at the screen edge
+        double startThickness;   // Thickness at the cursor end
+        double endThickness;     // Thickness at the screen edge
+        int totalDistance;       // Cursor to screen edge, drives the shape spacing
+
+        // Tapered quad covering the arm, scaled by widthFactor (0.5 for the inner contrast line)
+        QPolygonF outline(double widthFactor = 1.0) const;
+        // Square closing line drawn across the start of the arm
+        QRectF closingLine() const;
+        // One pixel wide center line running along the arm
+        QRectF centerLine() const;
+        // Unit vector pointing from the arm back towards the cursor
+        QPointF towardsCenter() const;
+    };
+
+    struct ShapeInstance {
+        QPointF center;
+        int radius;
+        Arm arm;
+    };
+
+    CrosshairGeometry(const CrosshairRenderer::Settings& settings, const QPoint& mousePos,
+                      const QRect& screenGeometry, int baseThickness);
+
+    const ArmGeometry& arm(Arm arm) const { return m_arms[arm]; }
+    const QVector<ShapeInstance>& shapes() const { return m_shapes; }
+
+    // Area covered by one arm including its closing line and direction shapes
+    QRectF armBounds(Arm arm) const;
+
+    // Paints one arm, its closing line and its shapes with QPainter. Used by the
+    // backends that rasterize arms into their own buffers.
+    void paintArm(QPainter& painter, Arm arm, const CrosshairRenderer::Settings& settings) const;
+
+    // Paints the tapered arm with its contrast and center line, without the closing
+    // line and shapes. Linear along the arm, so it can be stretched to any length.
+    static void paintArmBody(QPainter& painter, const ArmGeometry& arm, const CrosshairRenderer::Settings& settings);
+
+    // Horizontal and vertical bands covered by this frame, used for damage tracking
+    QRect horizontalBand() const;
+    QRect verticalBand() const;
+
+    // Distances from the arm start at which direction shapes are placed
+    static std::vector<double> shapeDistances(const CrosshairRenderer::Settings& settings,
+                                              int baseThickness, int totalDistance);
+
+    // Outline of a single direction shape centred on center, pointing along towardsCenter
+    static QPainterPath shapePath(CrosshairRenderer::DirectionShape shape, const QPointF& center,
+                                  int radius, const QPointF& towardsCenter);
+
+private:
+    void buildShapes(const CrosshairRenderer::Settings& settings, int baseThickness,
+                     const QRect& screenGeometry);
+
+    ArmGeometry m_arms[ArmCount];
+    QVector<ShapeInstance> m_shapes;
+};
+
+#endif // CROSSHAIRGEOMETRY_H
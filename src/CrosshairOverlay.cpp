@@ -21,35 +21,319 @@
  */
 
 #include "CrosshairOverlay.h"
+#include "Logging.h"
 #include "CrosshairRenderer.h"
 #include "SettingsManager.h"
+#include "RendererRegistry.h"
+#include "CursorSource.h"
+#include "PollingCursorSource.h"
+#include "FrameScheduler.h"
+#include "SessionStateMonitor.h"
+#include "PowerMonitor.h"
+#include "ActiveWindowTracker.h"
+#include "RenderPrewarmer.h"
+#include <QGuiApplication>
+#include <QTimer>
+#include <QScreen>
+#include <QCursor>
 #include <QDebug>
 
-CrosshairOverlay::CrosshairOverlay(QObject *parent)
+namespace {
+
+// Delay before measuring the renderers on a new session, lets startup settle first
+const int BenchmarkDelayMs = 3000;
+
+}
+
+CrosshairOverlay::CrosshairOverlay(SettingsManager* settings, QObject *parent)
     : QObject(parent)
+    , m_settings(settings)
+    , m_frameScheduler(std::make_unique<FrameScheduler>())
+    , m_settleTimer(new QTimer(this))
+    , m_idleTimer(new QTimer(this))
+    , m_autoHideMs(0)
+    , m_idleHidden(false)
+    , m_shakeToLocate(false)
+    , m_sessionMonitor(new SessionStateMonitor(this))
+    , m_powerMonitor(new PowerMonitor(this))
+    , m_windowTracker(new ActiveWindowTracker(this))
+    , m_prewarmer(new RenderPrewarmer(this))
+    , m_prewarmProfile(-1)
+    , m_activeProfile(-1)
+    , m_excluded(false)
+    , m_shown(false)
+    , m_momentary(false)
+    , m_warmToggle(settings->warmToggle())
+    , m_capabilities(RendererCapabilities::probe())
+    , m_benchmark(nullptr)
+    , m_remoteSession(m_capabilities.remote)
+    , m_pendingSampleTime(0)
+    , m_toggleTime(0)
+{
+    // Predicted and filtered positions are off once the pointer stops, show the real one then
+    m_settleTimer->setSingleShot(true);
+    connect(m_settleTimer, &QTimer::timeout, this, [this]() {
+        if (m_renderer && m_cursorSource->isActive()) {
+            const CursorSample& sample = m_cursorSource->lastSample();
+            m_jitterFilter.reset();
+            drawAt(sample.pos, sample.timestamp);
+        }
+    });
+    m_idleTimer->setSingleShot(true);
+    connect(m_idleTimer, &QTimer::timeout, this, &CrosshairOverlay::hideWhileIdle);
+    updateActivation(settings);
+    m_predictor.setEnabled(settings->motionPrediction());
+    m_jitterFilter.setEnabled(settings->jitterFilter());
+    m_jitterFilter.setDeadZone(settings->jitterDeadZone());
+    m_governor.setEnabled(settings->adaptiveQuality());
+    connect(m_sessionMonitor, &SessionStateMonitor::suspendedChanged, this, &CrosshairOverlay::handleSuspendedChanged);
+    connect(m_powerMonitor, &PowerMonitor::onBatteryChanged, this, &CrosshairOverlay::applyRenderProfile);
+    connect(m_windowTracker, &ActiveWindowTracker::activeWindowChanged,
+            m_sessionMonitor, &SessionStateMonitor::setActiveWindow);
+    connect(m_windowTracker, &ActiveWindowTracker::activeApplicationChanged,
+            this, &CrosshairOverlay::handleActiveApplicationChanged);
+    connect(m_prewarmer, &RenderPrewarmer::ready, this, [this](const std::shared_ptr<const PrewarmedState>& state) {
+        m_profilePrewarms.insert(m_prewarmProfile, state);
+        // Focus may have moved to a profile that was already prewarmed meanwhile
+        if (state->settings != m_governor.apply(m_effectiveSettings)) return;
+        m_prewarmed = state;
+        if (m_renderer) m_renderer->adoptPrewarmedState(state);
+    });
+    connect(qGuiApp, &QGuiApplication::screenAdded, this, &CrosshairOverlay::handleScreensChanged);
+    connect(qGuiApp, &QGuiApplication::screenRemoved, this, &CrosshairOverlay::handleScreensChanged);
+    buildProfiles(settings);
+    if (m_remoteSession) {
+        qCDebug(lcDiagnostics) << "Remote session detected";
+    }
+
+    setCursorSource(CursorSource::create());
+    createRenderer(settings);
+}
+
+CrosshairOverlay::~CrosshairOverlay()
 {
-    m_renderer = CrosshairRenderer::createPlatformRenderer();
+    m_shown = false;
+    m_sessionMonitor->stop();
+    m_windowTracker->stop();
+    m_cursorSource->stop();
     if (m_renderer) {
+        m_renderer->cleanup();
+        m_renderer.reset();
+    }
+}
+
+void CrosshairOverlay::setCursorSource(std::unique_ptr<CursorSource> source)
+{
+    m_cursorSource = std::move(source);
+    m_cursorSource->setFrameScheduler(m_frameScheduler.get());
+    m_cursorSource->setIdleBackoff(m_settings->pollIdleIntervals(), m_settings->pollIdleTicks());
+    qCDebug(lcDiagnostics) << "Using cursor source" << m_cursorSource->name();
+    connect(m_cursorSource.get(), &CursorSource::sampleReady, this, &CrosshairOverlay::handleSample);
+}
+
+void CrosshairOverlay::handleSample(const CursorSample& rawSample)
+{
+    updateRefreshRate(rawSample.pos);
+    if (!m_renderer) return;
+    ++m_diagnostics.samples;
+
+    // The source keeps running while idle hidden, the first motion brings the crosshair
+    // back, or in locate on shake mode the first motion that completes a shake
+    const bool wasIdleHidden = m_idleHidden;
+    if (m_idleHidden) {
+        if (m_shakeToLocate && !m_shakeDetector.addSample(rawSample.pos, rawSample.timestamp)) return;
+        m_idleHidden = false;
+        m_renderer->startRendering();
+    }
+    restartIdleTimer();
+
+    CursorSample sample = rawSample;
+    m_jitterFilter.filter(sample);
+
+    QPoint pos = sample.pos;
+    if (m_predictor.isEnabled()) {
+        const qint64 horizon = m_predictor.latency()
+            + m_renderer->presentationDelayFrames() * m_frameScheduler->frameInterval();
+        pos = m_predictor.predict(sample, horizon);
+    }
+
+    // Other master pointers are drawn unfiltered in the same pass as the main one
+    const bool extraPointersMoved = m_renderer->supportsExtraPointers()
+                                    && sample.extraPointers != m_drawnExtraPointers;
+    if (extraPointersMoved) {
+        m_drawnExtraPointers = sample.extraPointers;
+        m_renderer->setExtraPointers(m_drawnExtraPointers);
+    }
+
+    if (wasIdleHidden || extraPointersMoved || m_jitterFilter.exceedsDeadZone(m_drawnPos, pos)) {
+        drawAt(pos, sample.timestamp);
+    } else {
+        ++m_diagnostics.suppressedRepaints;
+    }
+
+    if (m_drawnPos != rawSample.pos) {
+        m_settleTimer->start(2 * m_frameScheduler->frameIntervalMs());
+    }
+}
+
+void CrosshairOverlay::drawAt(const QPoint& pos, qint64 sampleTime)
+{
+    ++m_diagnostics.repaints;
+    m_drawnPos = pos;
+    m_pendingSampleTime = sampleTime;
+    m_renderer->updateMousePosition(pos);
+}
+
+void CrosshairOverlay::restartIdleTimer()
+{
+    if (m_autoHideMs > 0 && !m_momentary) {
+        m_idleTimer->start(m_autoHideMs);
+    } else {
+        m_idleTimer->stop();
+    }
+}
+
+void CrosshairOverlay::hideWhileIdle()
+{
+    // Hide but keep the cursor source, an event-driven source costs nothing until the next move
+    if (!m_renderer || !m_renderer->isRendering()) return;
+    m_idleHidden = true;
+    m_settleTimer->stop();
+    m_frameScheduler->cancel();
+    m_predictor.reset();
+    m_jitterFilter.reset();
+    m_shakeDetector.reset();
+    if (m_warmToggle) {
+        m_renderer->parkRendering();
+    } else {
+        m_renderer->stopRendering();
+    }
+}
+
+void CrosshairOverlay::updateActivation(SettingsManager* settings)
+{
+    // In locate on shake mode the crosshair hides like auto-hide, after the shake time
+    const bool wasShakeToLocate = m_shakeToLocate;
+    m_shakeToLocate = settings->shakeToLocate();
+    m_autoHideMs = (m_shakeToLocate ? settings->shakeShowSeconds() : settings->autoHideSeconds()) * 1000;
+    if (!isVisible()) return;
+
+    if (m_shakeToLocate && !wasShakeToLocate && !m_momentary) {
+        hideWhileIdle();
+    } else {
+        restartIdleTimer();
+    }
+}
+
+void CrosshairOverlay::handleFramePresented()
+{
+    // Step the quality down while frames overrun the refresh, back up once they fit again
+    if (m_renderer && m_governor.addFrame(m_renderer->lastFrameTime(), m_frameScheduler->frameInterval())) {
+        m_diagnostics.qualityLevel = m_governor.level();
+        ++m_diagnostics.qualityChanges;
+        qCDebug(lcDiagnostics) << "Render quality" << QualityGovernor::levelName(m_governor.level());
+        m_renderer->updateSettings(m_governor.apply(m_effectiveSettings));
+        requestPrewarm();
+    }
+
+    if (m_toggleTime != 0) {
+        m_diagnostics.toggleLatency = m_frameScheduler->clock()->now() - m_toggleTime;
+        m_toggleTime = 0;
+        qCDebug(lcDiagnostics) << "Toggle to first frame:" << m_diagnostics.toggleLatency / 1000 << "us";
+    }
+
+    // Only the first frame after a sample says how long the sample took to show
+    if (m_pendingSampleTime == 0) return;
+    m_predictor.addLatencySample(m_frameScheduler->clock()->now() - m_pendingSampleTime);
+    m_pendingSampleTime = 0;
+}
+
+void CrosshairOverlay::updateRefreshRate(const QPoint& pos)
+{
+    // Pace frames to the screen the cursor is on, mixed 60/144 Hz setups are common
+    if (m_cursorScreen && m_cursorScreen->geometry().contains(pos)) return;
+
+    m_cursorScreen = QGuiApplication::screenAt(pos);
+    if (!m_cursorScreen) m_cursorScreen = QGuiApplication::primaryScreen();
+    if (m_cursorScreen) {
+        m_frameScheduler->setRefreshRate(m_cursorScreen->refreshRate());
+    }
+}
+
+void CrosshairOverlay::createRenderer(SettingsManager* settings)
+{
+    m_requestedBackend = settings->rendererBackend();
+    m_backendId = RendererRegistry::selectBackend(settings, m_capabilities);
+    qCDebug(lcDiagnostics) << "Using crosshair renderer" << m_backendId;
+
+    m_renderer = RendererRegistry::create(m_backendId);
+    m_drawnExtraPointers.clear();
+    if (m_renderer) {
+        m_renderer->setFramePresentedCallback([this]() { handleFramePresented(); });
         if (!m_renderer->initialize()) {
             qWarning() << "Failed to initialize crosshair renderer";
             m_renderer.reset();
+        } else if (m_prewarmed) {
+            m_renderer->adoptPrewarmedState(m_prewarmed);
         }
     } else {
         qWarning() << "Failed to create platform-specific crosshair renderer";
     }
+
+    // Measure the candidates once startup settled, not on the way to the first frame
+    if (RendererRegistry::needsBenchmark(settings, m_capabilities)) {
+        QTimer::singleShot(BenchmarkDelayMs, this, &CrosshairOverlay::runRendererBenchmark);
+    }
 }
 
-CrosshairOverlay::~CrosshairOverlay()
+void CrosshairOverlay::recreateRenderer(SettingsManager* settings)
 {
+    const bool restart = isVisible();
     if (m_renderer) {
         m_renderer->cleanup();
+        m_renderer.reset();
+    }
+    createRenderer(settings);
+
+    if (!m_renderer) return;
+    applyRenderProfile();
+    if (restart) {
+        m_renderer->startRendering();
     }
 }
 
-void CrosshairOverlay::updateFromSettings(SettingsManager* settings)
+void CrosshairOverlay::runRendererBenchmark()
+{
+    // Settings or the environment may have made the result moot in the meantime
+    if (m_benchmark || !RendererRegistry::needsBenchmark(m_settings, m_capabilities)) return;
+
+    // The live overlay would compete with the candidates, pause it while measuring
+    m_benchmark = new RendererBenchmark(m_capabilities, m_baseSettings, this);
+    connect(m_benchmark, &RendererBenchmark::finished, this, &CrosshairOverlay::handleBenchmarkFinished);
+    if (m_shown) {
+        suspendRendering();
+    }
+    m_benchmark->start();
+}
+
+void CrosshairOverlay::handleBenchmarkFinished(const QString& result)
+{
+    m_benchmark->deleteLater();
+    m_benchmark = nullptr;
+
+    const QString fastest = result.isEmpty() ? RendererRegistry::defaultBackend(m_capabilities) : result;
+    m_settings->setBenchmarkedRenderer(fastest, m_capabilities.fingerprint());
+    if (fastest != m_backendId) {
+        recreateRenderer(m_settings);
+    }
+
+    if (m_shown && !m_sessionMonitor->isSuspended()) {
+        resumeRendering();
+    }
+}
+
+CrosshairRenderer::Settings CrosshairOverlay::rendererSettings(SettingsManager* settings)
 {
-    if (!m_renderer) return;
-    
     CrosshairRenderer::Settings rendererSettings;
     rendererSettings.color = settings->crosshairColor();
     rendererSettings.lineWidth = settings->crosshairLineWidth();
@@ -59,22 +343,328 @@ void CrosshairOverlay::updateFromSettings(SettingsManager* settings)
     rendererSettings.showArrows = settings->showArrows();
     rendererSettings.circleSpacingIncrease = settings->circleSpacingIncrease();
     rendererSettings.directionShape = settings->directionShape();
+    rendererSettings.colorPerPointer = settings->colorPerPointer();
     rendererSettings.inverted = false; // Can be added to settings later if needed
+    return rendererSettings;
+}
+
+void CrosshairOverlay::applyOverrides(CrosshairRenderer::Settings& settings, const QVariantMap& overrides)
+{
+    // Keys as under crosshair/ in the settings file
+    for (auto it = overrides.constBegin(); it != overrides.constEnd(); ++it) {
+        const QString& key = it.key();
+        const QVariant& value = it.value();
+        if (key == QLatin1String("color")) {
+            const QColor color = value.value<QColor>();
+            if (color.isValid()) settings.color = color;
+        } else if (key == QLatin1String("lineWidth")) {
+            settings.lineWidth = qBound(1, value.toInt(), 50);
+        } else if (key == QLatin1String("offsetFromCursor")) {
+            settings.offsetFromCursor = qMax(0, value.toInt());
+        } else if (key == QLatin1String("thicknessMultiplier")) {
+            settings.thicknessMultiplier = qBound(1.0, value.toDouble(), 10.0);
+        } else if (key == QLatin1String("opacity")) {
+            settings.opacity = qBound(0.1, value.toDouble(), 1.0);
+        } else if (key == QLatin1String("showArrows")) {
+            settings.showArrows = value.toBool();
+        } else if (key == QLatin1String("circleSpacingIncrease")) {
+            settings.circleSpacingIncrease = qMax(0.0, value.toDouble());
+        } else if (key == QLatin1String("directionShape")) {
+            settings.directionShape = static_cast<CrosshairRenderer::DirectionShape>(qBound(0, value.toInt(), 3));
+        } else {
+            qWarning() << "Unknown profile setting" << key;
+        }
+    }
+}
+
+void CrosshairOverlay::buildProfiles(SettingsManager* settings)
+{
+    // Every profile's render state is derived up front, a focus change only swaps it
+    m_baseSettings = rendererSettings(settings);
+    m_profiles.clear();
+    m_profileIndex.clear();
+    m_profilePrewarms.clear();
+    for (const SettingsManager::AppProfile& profile : settings->appProfiles()) {
+        ProfileState state;
+        state.exclude = profile.exclude;
+        state.settings = m_baseSettings;
+        applyOverrides(state.settings, profile.overrides);
+        for (const QString& match : profile.matches) {
+            m_profileIndex.insert(match, m_profiles.size());
+        }
+        m_profiles.append(state);
+    }
+    m_activeProfile = profileFor(m_activeApplication);
+}
+
+int CrosshairOverlay::profileFor(const QStringList& names) const
+{
+    for (const QString& name : names) {
+        auto it = m_profileIndex.constFind(name);
+        if (it != m_profileIndex.constEnd()) {
+            return it.value();
+        }
+    }
+    return -1;
+}
+
+void CrosshairOverlay::handleActiveApplicationChanged(const QStringList& names)
+{
+    m_activeApplication = names;
+    const int profile = profileFor(names);
+    if (profile == m_activeProfile) return;
+
+    m_activeProfile = profile;
+    applyRenderProfile();
+    setExcluded(profile >= 0 && m_profiles[profile].exclude);
+}
+
+void CrosshairOverlay::setExcluded(bool excluded)
+{
+    if (excluded == m_excluded) return;
+    m_excluded = excluded;
+    if (!m_shown) return;
+
+    if (excluded) {
+        suspendRendering();
+    } else if (!m_sessionMonitor->isSuspended()) {
+        resumeRendering();
+    }
+}
+
+void CrosshairOverlay::stopWindowTracker()
+{
+    // Nothing is known about the focused application while not watching
+    m_windowTracker->stop();
+    m_activeApplication.clear();
+    m_excluded = false;
+    if (m_activeProfile >= 0) {
+        m_activeProfile = -1;
+        applyRenderProfile();
+    }
+}
+
+void CrosshairOverlay::updateFromSettings(SettingsManager* settings)
+{
+    m_cursorSource->setIdleBackoff(settings->pollIdleIntervals(), settings->pollIdleTicks());
+    m_predictor.setEnabled(settings->motionPrediction());
+    m_jitterFilter.setEnabled(settings->jitterFilter());
+    m_jitterFilter.setDeadZone(settings->jitterDeadZone());
+    m_governor.setEnabled(settings->adaptiveQuality());
+    m_warmToggle = settings->warmToggle();
+    if (!m_warmToggle && !m_shown && m_renderer) {
+        // Unmap an overlay parked by an earlier hide()
+        m_renderer->stopRendering();
+    }
+    updateActivation(settings);
+    buildProfiles(settings);
+    updateMonitors(settings);
+    if (m_windowTracker->isActive()) {
+        setExcluded(m_activeProfile >= 0 && m_profiles[m_activeProfile].exclude);
+    }
+    
+    // Switch backends at runtime when the manual override changes
+    if (settings->rendererBackend() != m_requestedBackend) {
+        recreateRenderer(settings);
+        return;
+    }
     
-    m_renderer->updateSettings(rendererSettings);
+    if (m_renderer) {
+        applyRenderProfile();
+    }
 }
 
 void CrosshairOverlay::show()
 {
+    m_shown = true;
+    m_diagnostics = Diagnostics();
+    m_diagnostics.qualityLevel = m_governor.level();
+    updateMonitors(m_settings);
+
+    // Measured up to the first frame, which some backends present before startRendering() returns
+    m_toggleTime = m_frameScheduler->clock()->now();
+    if (!m_sessionMonitor->isSuspended()) {
+        resumeRendering();
+    }
+    if (!isVisible()) {
+        m_toggleTime = 0;
+    }
+}
+
+void CrosshairOverlay::showMomentary()
+{
+    m_momentary = true;
+    show();
+}
+
+void CrosshairOverlay::hide()
+{
+    m_shown = false;
+    m_momentary = false;
+    m_sessionMonitor->stop();
+    m_powerMonitor->stop();
+    stopWindowTracker();
+    if (m_renderer && m_renderer->isRendering()) {
+        qCDebug(lcDiagnostics) << "Cursor samples:" << m_diagnostics.samples
+                 << "repaints:" << m_diagnostics.repaints
+                 << "suppressed by jitter filter:" << m_diagnostics.suppressedRepaints
+                 << "render quality:" << QualityGovernor::levelName(m_diagnostics.qualityLevel)
+                 << "quality changes:" << m_diagnostics.qualityChanges
+                 << "toggle to first frame (us):" << m_diagnostics.toggleLatency / 1000;
+    }
+    // Stay mapped when toggling warm, showing again is then a single partial repaint
+    suspendRendering(m_warmToggle);
+}
+
+void CrosshairOverlay::updateMonitors(SettingsManager* settings)
+{
+    // Only watch the session and power state while the crosshair is meant to be on screen
+    if (!m_shown) return;
+    // One focus watcher serves both the fullscreen check and the profiles
+    if (settings->autoSuspend() || !m_profiles.isEmpty()) {
+        m_windowTracker->start();
+    } else if (m_windowTracker->isActive()) {
+        stopWindowTracker();
+    }
+
+    if (settings->autoSuspend()) {
+        m_sessionMonitor->start();
+        m_sessionMonitor->setActiveWindow(m_windowTracker->activeWindow());
+    } else {
+        m_sessionMonitor->stop();
+    }
+
+    // Profiles applied while the monitor was stopped ignored the battery, so
+    // apply again once it is known
+    if (settings->lowPowerProfile()) {
+        if (!m_powerMonitor->isActive()) {
+            m_powerMonitor->start();
+            applyRenderProfile();
+        }
+    } else {
+        m_powerMonitor->stop();
+    }
+}
+
+void CrosshairOverlay::applyRenderProfile()
+{
+    CrosshairRenderer::Settings settings = m_activeProfile >= 0 ? m_profiles[m_activeProfile].settings : m_baseSettings;
+    qreal rateCap = 0;
+
+    // Every changed pixel is encoded and sent over the network in remote sessions.
+    // Opaque flat arms compress well and the damage tracking keeps the update small.
+    if (m_remoteSession && m_settings->remoteProfile()) {
+        rateCap = m_settings->remoteFrameRate();
+        settings.opacity = 1.0;
+        settings.solidArms = true;
+        settings.showArrows = false;
+        settings.antialiasing = false;
+    }
+
+    // Fewer frames and cheaper pixels while on battery, applied live
+    if (m_settings->lowPowerProfile() && m_powerMonitor->isActive() && m_powerMonitor->onBattery()) {
+        const qreal lowPowerRate = m_settings->lowPowerFrameRate();
+        rateCap = rateCap > 0 ? qMin(rateCap, lowPowerRate) : lowPowerRate;
+        settings.showArrows = settings.showArrows && m_settings->lowPowerDirectionShapes();
+        settings.antialiasing = settings.antialiasing && m_settings->lowPowerAntialiasing();
+    }
+
+    m_frameScheduler->setRateCap(rateCap);
+    m_effectiveSettings = settings;
+
+    // Costs of every quality level for the governor, on the desktop the overlay covers
+    QScreen* screen = m_cursorScreen ? m_cursorScreen.data() : QGuiApplication::primaryScreen();
+    if (screen) {
+        const int baseThickness = qMax(3, qRound(settings.lineWidth * screen->devicePixelRatio()));
+        const bool taperSegments = m_renderer && m_renderer->drawsTaperSegments();
+        m_governor.setWorkload(settings, screen->virtualGeometry(), baseThickness, taperSegments);
+    }
+
     if (m_renderer) {
+        m_renderer->updateSettings(m_governor.apply(settings));
+    }
+    requestPrewarm();
+}
+
+void CrosshairOverlay::requestPrewarm()
+{
+    const CrosshairRenderer::Settings settings = m_governor.apply(m_effectiveSettings);
+
+    // Each profile is prewarmed once, switching focus back to it only swaps the state
+    const std::shared_ptr<const PrewarmedState> cached = m_profilePrewarms.value(m_activeProfile);
+    if (cached && cached->settings == settings) {
+        if (cached != m_prewarmed) {
+            m_prewarmed = cached;
+            if (m_renderer) m_renderer->adoptPrewarmedState(cached);
+        }
+        return;
+    }
+
+    // Derive the caches off the GUI thread so the first frame after a change only draws
+    m_prewarmProfile = m_activeProfile;
+    m_prewarmer->request(settings);
+}
+
+void CrosshairOverlay::handleScreensChanged()
+{
+    // Prewarmed states cover the screens at the time they were built
+    m_profilePrewarms.clear();
+    requestPrewarm();
+}
+
+void CrosshairOverlay::handleSuspendedChanged(bool suspended)
+{
+    if (!m_shown) return;
+    if (suspended) {
+        suspendRendering();
+    } else {
+        resumeRendering();
+    }
+}
+
+void CrosshairOverlay::resumeRendering()
+{
+    if (!m_renderer || m_renderer->isRendering() || m_idleHidden || m_excluded || m_benchmark) return;
+
+    m_drawnExtraPointers.clear();
+    m_renderer->setExtraPointers(m_drawnExtraPointers);
+    m_cursorScreen = nullptr;
+    updateRefreshRate(QCursor::pos());
+    if (m_shakeToLocate && !m_momentary) {
+        // Only the shake detector runs until the mouse is shaken
+        m_idleHidden = true;
+        m_shakeDetector.reset();
+    } else {
         m_renderer->startRendering();
+        m_drawnPos = QCursor::pos();
+    }
+    if (!m_cursorSource->start()) {
+        // The preferred source can go away, e.g. unplugged input devices
+        qWarning() << "Cursor source" << m_cursorSource->name() << "failed to start, polling instead";
+        setCursorSource(std::make_unique<PollingCursorSource>());
+        m_cursorSource->start();
+    }
+    if (!m_idleHidden) {
+        restartIdleTimer();
     }
 }
 
-void CrosshairOverlay::hide()
+void CrosshairOverlay::suspendRendering(bool park)
 {
+    // Nothing to follow while hidden, stop receiving motion events as well
+    m_cursorSource->stop();
+    m_frameScheduler->cancel();
+    m_settleTimer->stop();
+    m_idleTimer->stop();
+    m_idleHidden = false;
+    m_predictor.reset();
+    m_jitterFilter.reset();
     if (m_renderer) {
-        m_renderer->stopRendering();
+        if (park) {
+            m_renderer->parkRendering();
+        } else {
+            m_renderer->stopRendering();
+        }
     }
 }
 
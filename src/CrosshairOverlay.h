@@ -24,26 +24,135 @@
 #define CROSSHAIROVERLAY_H
 
 #include <QObject>
+#include <QString>
+#include <QPointer>
+#include <QScreen>
+#include <QHash>
+#include <QStringList>
+#include <QVariantMap>
 #include <memory>
+#include "CrosshairRenderer.h"
+#include "MotionPredictor.h"
+#include "JitterFilter.h"
+#include "ShakeDetector.h"
+#include "QualityGovernor.h"
+#include "RendererRegistry.h"
 
 class SettingsManager;
-class CrosshairRenderer;
+class CursorSource;
+class FrameScheduler;
+class SessionStateMonitor;
+class PowerMonitor;
+class ActiveWindowTracker;
+class RenderPrewarmer;
+struct PrewarmedState;
+class QTimer;
 
 class CrosshairOverlay : public QObject
 {
     Q_OBJECT
 
 public:
-    explicit CrosshairOverlay(QObject *parent = nullptr);
+    explicit CrosshairOverlay(SettingsManager* settings, QObject *parent = nullptr);
     ~CrosshairOverlay();
     
     void updateFromSettings(SettingsManager* settings);
     void show();
     void hide();
     bool isVisible() const;
+    
+    // Shown for as long as a hotkey is held, auto-hide and shake to locate do not apply
+    void showMomentary();
+    
+    // Id of the active renderer backend, see RendererRegistry
+    QString backendId() const { return m_backendId; }
+    
+    // Counters for tuning the cursor pipeline, reset on show()
+    struct Diagnostics {
+        quint64 samples = 0;            // Samples delivered by the cursor source
+        quint64 repaints = 0;           // Positions handed to the renderer
+        quint64 suppressedRepaints = 0; // Samples that stayed inside the jitter dead zone
+        QualityGovernor::Level qualityLevel = QualityGovernor::Full; // Current render quality
+        quint64 qualityChanges = 0;     // Steps the quality governor took
+        qint64 toggleLatency = 0;       // ns from show() to the first frame, 0 until shown
+    };
+    const Diagnostics& diagnostics() const { return m_diagnostics; }
 
 private:
+    // Derived render state of an application profile, built when the settings change
+    struct ProfileState {
+        bool exclude = false;
+        CrosshairRenderer::Settings settings;
+    };
+
+    static CrosshairRenderer::Settings rendererSettings(SettingsManager* settings);
+    static void applyOverrides(CrosshairRenderer::Settings& settings, const QVariantMap& overrides);
+    void createRenderer(SettingsManager* settings);
+    void recreateRenderer(SettingsManager* settings);
+    void runRendererBenchmark();
+    void handleBenchmarkFinished(const QString& result);
+    void setCursorSource(std::unique_ptr<CursorSource> source);
+    void updateRefreshRate(const QPoint& pos);
+    void handleSample(const CursorSample& sample);
+    void handleFramePresented();
+    void drawAt(const QPoint& pos, qint64 sampleTime);
+    void updateMonitors(SettingsManager* settings);
+    void applyRenderProfile();
+    void handleSuspendedChanged(bool suspended);
+    void resumeRendering();
+    void suspendRendering(bool park = false);
+    void restartIdleTimer();
+    void hideWhileIdle();
+    void updateActivation(SettingsManager* settings);
+    void buildProfiles(SettingsManager* settings);
+    int profileFor(const QStringList& names) const;
+    void handleActiveApplicationChanged(const QStringList& names);
+    void setExcluded(bool excluded);
+    void stopWindowTracker();
+    void requestPrewarm();
+    void handleScreensChanged();
+    
+    SettingsManager* m_settings;
     std::unique_ptr<CrosshairRenderer> m_renderer;
+    std::unique_ptr<FrameScheduler> m_frameScheduler;
+    std::unique_ptr<CursorSource> m_cursorSource;
+    QPointer<QScreen> m_cursorScreen;
+    MotionPredictor m_predictor;
+    JitterFilter m_jitterFilter;
+    ShakeDetector m_shakeDetector;
+    QPoint m_drawnPos;
+    QVector<QPoint> m_drawnExtraPointers;
+    Diagnostics m_diagnostics;
+    QualityGovernor m_governor;
+    CrosshairRenderer::Settings m_effectiveSettings;
+    QTimer* m_settleTimer;
+    QTimer* m_idleTimer;
+    int m_autoHideMs;
+    bool m_idleHidden;
+    bool m_shakeToLocate;
+    SessionStateMonitor* m_sessionMonitor;
+    PowerMonitor* m_powerMonitor;
+    ActiveWindowTracker* m_windowTracker;
+    RenderPrewarmer* m_prewarmer;
+    std::shared_ptr<const PrewarmedState> m_prewarmed;
+    QHash<int, std::shared_ptr<const PrewarmedState>> m_profilePrewarms; // By profile, -1 for none
+    int m_prewarmProfile; // Profile of the prewarm in flight
+    CrosshairRenderer::Settings m_baseSettings;
+    QVector<ProfileState> m_profiles;
+    QHash<QString, int> m_profileIndex;
+    QStringList m_activeApplication;
+    int m_activeProfile;
+    bool m_excluded;
+    bool m_shown;
+    bool m_momentary;
+    bool m_warmToggle;
+    RendererCapabilities m_capabilities; // Probed once, when the overlay is created
+    RendererBenchmark* m_benchmark;      // Set while the backends are measured
+    bool m_remoteSession;
+    qint64 m_pendingSampleTime;
+    qint64 m_toggleTime;
+    QString m_backendId;
+    QString m_requestedBackend;
 };
 
 #endif // CROSSHAIROVERLAY_H
\ No newline at end of file
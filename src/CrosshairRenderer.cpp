@@ -22,23 +22,46 @@
 
 #include "CrosshairRenderer.h"
 
-#ifdef Q_OS_MAC
-#include "MacOSCrosshairRenderer.h"
-#elif defined(Q_OS_WIN)
-#include "WindowsCrosshairRenderer.h"
-#else
-// Linux/X11 implementation can use the Windows renderer as a fallback
-#include "WindowsCrosshairRenderer.h"
+#ifdef HAVE_X11
+#include "X11Support.h"
+#include <X11/Xlib.h>
 #endif
 
-std::unique_ptr<CrosshairRenderer> CrosshairRenderer::createPlatformRenderer()
+bool CrosshairRenderer::Settings::operator==(const Settings& other) const
 {
-#ifdef Q_OS_MAC
-    return std::make_unique<MacOSCrosshairRenderer>();
-#elif defined(Q_OS_WIN)
-    return std::make_unique<WindowsCrosshairRenderer>();
-#else
-    // Linux/X11 can use the same approach as Windows
-    return std::make_unique<WindowsCrosshairRenderer>();
+    return color == other.color
+        && lineWidth == other.lineWidth
+        && offsetFromCursor == other.offsetFromCursor
+        && thicknessMultiplier == other.thicknessMultiplier
+        && opacity == other.opacity
+        && showArrows == other.showArrows
+        && inverted == other.inverted
+        && circleSpacingIncrease == other.circleSpacingIncrease
+        && directionShape == other.directionShape
+        && colorPerPointer == other.colorPerPointer
+        && antialiasing == other.antialiasing
+        && solidArms == other.solidArms
+        && taperSegments == other.taperSegments
+        && shapeStride == other.shapeStride;
+}
+
+void CrosshairRenderer::syncDisplay()
+{
+#ifdef HAVE_X11
+    // Qt and Xlib share the xcb connection, so this also waits for Qt's requests
+    if (Display* display = X11Support::display()) {
+        XSync(display, False);
+    }
 #endif
-}
\ No newline at end of file
+}
+
+QColor CrosshairRenderer::pointerColor(int index) const
+{
+    if (index == 0 || !m_settings.colorPerPointer) return m_settings.color;
+
+    // Step around the hue circle by the golden angle so neighbouring pointers differ
+    // clearly, and saturate grey or white base colours so the step is visible at all
+    const QColor base = m_settings.color.toHsv();
+    const int hue = (qMax(0, base.hsvHue()) + index * 137) % 360;
+    return QColor::fromHsv(hue, qMax(base.hsvSaturation(), 160), qMax(base.value(), 200), base.alpha());
+}
@@ -26,8 +26,12 @@
 #include <QColor>
 #include <QPoint>
 #include <QRect>
+#include <QVector>
+#include <functional>
 #include <memory>
 
+struct PrewarmedState;
+
 class CrosshairRenderer
 {
 public:
@@ -48,6 +52,14 @@ public:
         bool inverted = false;
         double circleSpacingIncrease = 5.0;
         DirectionShape directionShape = DirectionShape::Circle;
+        bool colorPerPointer = true;  // Distinct colours for further master pointers
+        bool antialiasing = true;     // Smooth taper edges, off in the low power profile
+        bool solidArms = false;       // Flat arms without taper or contrast line, compress well
+        int taperSegments = 50;       // Steps of the taper in backends that stroke the arms
+        int shapeStride = 1;          // Draw every n-th direction shape
+
+        bool operator==(const Settings& other) const;
+        bool operator!=(const Settings& other) const { return !(*this == other); }
     };
 
     virtual ~CrosshairRenderer() = default;
@@ -58,18 +70,62 @@ public:
     virtual void startRendering() = 0;
     virtual void stopRendering() = 0;
     
+    // Stops drawing but leaves the overlay mapped and empty, so the next
+    // startRendering() is one partial repaint instead of mapping a desktop sized
+    // window. stopRendering() unmaps a parked overlay. Backends without a
+    // cheaper path simply stop.
+    virtual void parkRendering() { stopRendering(); }
+    
     virtual void updateSettings(const Settings& settings) = 0;
     virtual void updateMousePosition(const QPoint& pos) = 0;
     
     virtual bool isRendering() const = 0;
     
-    static std::unique_ptr<CrosshairRenderer> createPlatformRenderer();
+    // Blocks until the display server has processed every request sent so far,
+    // used by the renderer benchmark after a frame was presented
+    virtual void syncDisplay();
+    
+    // Called once a frame for a new position has been handed to the display,
+    // used to measure render latency for motion prediction
+    void setFramePresentedCallback(std::function<void()> callback) { m_framePresented = std::move(callback); }
+    
+    // Refreshes between handing a frame over and it being visible, one for a
+    // composited overlay, zero when drawing straight into the screen
+    virtual int presentationDelayFrames() const { return 1; }
+    
+    // Time in ns the last frame took to render, 0 for backends that render
+    // asynchronously (in the X server or a scene graph thread) and cannot tell
+    qint64 lastFrameTime() const { return m_lastFrameTime; }
+    
+    // Further master pointers (XInput2 MPX) drawn alongside the main one. They
+    // take effect with the next updateMousePosition(), which repaints all
+    // crosshairs in one pass. Backends returning false only draw the main pointer.
+    virtual bool supportsExtraPointers() const { return false; }
+    void setExtraPointers(const QVector<QPoint>& pointers) { m_extraPointers = pointers; }
+    
+    // True for backends that stroke each arm in Settings::taperSegments steps.
+    // The others fill an arm as one tapered polygon and ignore the setting.
+    virtual bool drawsTaperSegments() const { return false; }
+    
+    
+    // Derived state and caches built off the GUI thread for the current settings,
+    // see RenderPrewarmer. Backends take over what they can before the next frame.
+    virtual void adoptPrewarmedState(const std::shared_ptr<const PrewarmedState>& state) { m_prewarmed = state; }
     
 protected:
+    void notifyFramePresented() { if (m_framePresented) m_framePresented(); }
+    
+    // Crosshair colour for pointer index, 0 being the main pointer
+    QColor pointerColor(int index) const;
+
     Settings m_settings;
     QPoint m_mousePos;
+    QVector<QPoint> m_extraPointers;
     QRect m_screenGeometry;
     bool m_isRendering = false;
+    qint64 m_lastFrameTime = 0;
+    std::shared_ptr<const PrewarmedState> m_prewarmed;
+    std::function<void()> m_framePresented;
 };
 
 #endif // CROSSHAIRRENDERER_H
\ No newline at end of file
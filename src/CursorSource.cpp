@@ -0,0 +1,144 @@
+/*
+ * MouseCross - A crosshair overlay application for visually impaired users
+ * Copyright (C) 2025 Stefan Lohmaier <stefan@slohmaier.de>
+ *
+ * This file is part of MouseCross.
+ *
+ * MouseCross is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MouseCross is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with MouseCross. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Project website: https://slohmaier.de/mousecross
+ */
+
+#include "CursorSource.h"
+#include "PollingCursorSource.h"
+#include "FrameScheduler.h"
+#include <QCursor>
+#include <QDebug>
+
+#ifdef HAVE_XINPUT2
+#include "XInput2CursorSource.h"
+#endif
+#ifdef HAVE_EVDEV
+#include "EvdevCursorSource.h"
+#endif
+
+namespace {
+
+// Samples further apart than this start a new movement, no velocity carries over
+const qint64 MaxVelocityGapNs = 100 * 1000 * 1000;
+
+}
+
+CursorSource::CursorSource(QObject *parent)
+    : QObject(parent)
+    , m_scheduler(nullptr)
+    , m_active(false)
+    , m_hasPendingPos(false)
+    , m_pendingReports(0)
+{
+}
+
+CursorSource::~CursorSource() = default;
+
+void CursorSource::setFrameScheduler(FrameScheduler* scheduler)
+{
+    if (m_scheduler) {
+        disconnect(m_scheduler, nullptr, this, nullptr);
+    }
+    m_scheduler = scheduler;
+    if (m_scheduler) {
+        connect(m_scheduler, &FrameScheduler::frameDue, this, &CursorSource::deliver);
+    }
+}
+
+void CursorSource::setActive(bool active)
+{
+    m_active = active;
+    if (!active) {
+        m_hasPendingPos = false;
+        m_pendingReports = 0;
+    }
+}
+
+void CursorSource::reportMotion()
+{
+    if (!m_active || !m_scheduler) return;
+    ++m_pendingReports;
+    m_scheduler->requestFrame();
+}
+
+void CursorSource::reportPosition(const QPoint& pos)
+{
+    if (!m_active || !m_scheduler) return;
+    m_pendingPos = pos;
+    m_hasPendingPos = true;
+    ++m_pendingReports;
+    m_scheduler->requestFrame();
+}
+
+QPoint CursorSource::queryPosition() const
+{
+    return QCursor::pos();
+}
+
+void CursorSource::deliver()
+{
+    // The scheduler may be shared, only deliver when this source reported something
+    if (!m_active || m_pendingReports == 0) return;
+
+    const QPoint pos = m_hasPendingPos ? m_pendingPos : queryPosition();
+    QVector<QPoint> extraPointers = queryExtraPointers();
+    const int reports = m_pendingReports;
+    m_hasPendingPos = false;
+    m_pendingReports = 0;
+
+    const qint64 now = m_scheduler->clock()->now();
+    if (pos == m_lastSample.pos && extraPointers == m_lastSample.extraPointers && m_lastSample.timestamp != 0) return;
+
+    CursorSample sample;
+    sample.pos = pos;
+    sample.timestamp = now;
+    sample.coalesced = reports;
+    sample.extraPointers = std::move(extraPointers);
+
+    const qint64 elapsed = now - m_lastSample.timestamp;
+    if (m_lastSample.timestamp != 0 && elapsed > 0 && elapsed < MaxVelocityGapNs) {
+        const QPointF delta = pos - m_lastSample.pos;
+        sample.velocity = delta * (1e9 / elapsed);
+    }
+
+    m_lastSample = sample;
+    emit sampleReady(sample);
+}
+
+std::unique_ptr<CursorSource> CursorSource::create()
+{
+    const QString requested = qEnvironmentVariable("MOUSECROSS_CURSOR_SOURCE");
+
+#ifdef HAVE_XINPUT2
+    if ((requested.isEmpty() || requested == QLatin1String("xinput2")) && XInput2CursorSource::isSupported()) {
+        return std::make_unique<XInput2CursorSource>();
+    }
+#endif
+#ifdef HAVE_EVDEV
+    // Only when the user can read /dev/input, e.g. is in the input group
+    if ((requested.isEmpty() || requested == QLatin1String("evdev")) && EvdevCursorSource::isSupported()) {
+        return std::make_unique<EvdevCursorSource>();
+    }
+#endif
+    if (!requested.isEmpty() && requested != QLatin1String("polling")) {
+        qWarning() << "Cursor source" << requested << "is not available, polling instead";
+    }
+    return std::make_unique<PollingCursorSource>();
+}
@@ -0,0 +1,101 @@
+/*
+ * MouseCross - A crosshair overlay application for visually impaired users
+ * Copyright (C) 2025 Stefan Lohmaier <stefan@slohmaier.de>
+ *
+ * This file is part of MouseCross.
+ *
+ * MouseCross is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MouseCross is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with MouseCross. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Project website: https://slohmaier.de/mousecross
+ */
+
+#ifndef CURSORSOURCE_H
+#define CURSORSOURCE_H
+
+#include <QObject>
+#include <QPoint>
+#include <QPointF>
+#include <QList>
+#include <QVector>
+#include <memory>
+
+class FrameScheduler;
+
+struct CursorSample {
+    QPoint pos;
+    QPointF velocity;       // Pixels per second since the previous sample
+    qint64 timestamp = 0;   // Nanoseconds on the frame scheduler's clock
+    int coalesced = 0;      // Device reports merged into this sample
+    QVector<QPoint> extraPointers;  // Further master pointers, empty without MPX
+};
+
+// Where the overlay gets the pointer position from. Devices may report at
+// 1000 Hz; implementations call reportMotion()/reportPosition() for every
+// report and the base class coalesces them into at most one sampleReady()
+// per frame of the FrameScheduler, so renderers repaint once per refresh.
+class CursorSource : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit CursorSource(QObject *parent = nullptr);
+    ~CursorSource() override;
+
+    virtual QString name() const = 0;
+    virtual bool start() = 0;
+    virtual void stop() = 0;
+    bool isActive() const { return m_active; }
+
+    // Slower poll intervals in ms used while the pointer rests, each entered after
+    // stillTicks ticks without movement. Event-driven sources are idle for free.
+    virtual void setIdleBackoff(const QList<int>& intervals, int stillTicks) { Q_UNUSED(intervals); Q_UNUSED(stillTicks); }
+
+    // Paces the samples, must be set before start()
+    void setFrameScheduler(FrameScheduler* scheduler);
+    FrameScheduler* frameScheduler() const { return m_scheduler; }
+
+    const CursorSample& lastSample() const { return m_lastSample; }
+
+    // Best source for this session, MOUSECROSS_CURSOR_SOURCE overrides the choice
+    static std::unique_ptr<CursorSource> create();
+
+signals:
+    void sampleReady(const CursorSample& sample);
+
+protected:
+    void setActive(bool active);
+
+    // The device moved, the position is read with queryPosition() at delivery
+    void reportMotion();
+    // The device reported an absolute position
+    void reportPosition(const QPoint& pos);
+
+    virtual QPoint queryPosition() const;
+    // Positions of further master pointers, read together with the main position
+    virtual QVector<QPoint> queryExtraPointers() const { return {}; }
+
+private slots:
+    void deliver();
+
+private:
+    FrameScheduler* m_scheduler;
+    bool m_active;
+
+    bool m_hasPendingPos;
+    QPoint m_pendingPos;
+    int m_pendingReports;
+    CursorSample m_lastSample;
+};
+
+#endif // CURSORSOURCE_H
@@ -0,0 +1,164 @@
+/*
+ * MouseCross - A crosshair overlay application for visually impaired users
+ * Copyright (C) 2025 Stefan Lohmaier <stefan@slohmaier.de>
+ *
+ * This file is part of MouseCross.
+ *
+ * MouseCross is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MouseCross is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with MouseCross. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Project website: https://slohmaier.de/mousecross
+ */
+
+#include "EvdevCursorSource.h"
+#include <QDir>
+#include <QSocketNotifier>
+#include <QDebug>
+
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/input.h>
+
+namespace {
+
+bool testBit(const unsigned long* bits, int bit)
+{
+    const int bitsPerLong = sizeof(unsigned long) * 8;
+    return bits[bit / bitsPerLong] & (1UL << (bit % bitsPerLong));
+}
+
+// Mice and touchpads report relative or absolute X, tablets absolute X
+bool isPointerDevice(int fd)
+{
+    const int bitsPerLong = sizeof(unsigned long) * 8;
+    unsigned long eventBits[(EV_MAX + bitsPerLong) / bitsPerLong] = {};
+    if (ioctl(fd, EVIOCGBIT(0, sizeof(eventBits)), eventBits) < 0) return false;
+
+    if (testBit(eventBits, EV_REL)) {
+        unsigned long relBits[(REL_MAX + bitsPerLong) / bitsPerLong] = {};
+        if (ioctl(fd, EVIOCGBIT(EV_REL, sizeof(relBits)), relBits) >= 0 && testBit(relBits, REL_X)) {
+            return true;
+        }
+    }
+    if (testBit(eventBits, EV_ABS) && testBit(eventBits, EV_KEY)) {
+        unsigned long absBits[(ABS_MAX + bitsPerLong) / bitsPerLong] = {};
+        if (ioctl(fd, EVIOCGBIT(EV_ABS, sizeof(absBits)), absBits) >= 0 && testBit(absBits, ABS_X)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+}
+
+EvdevCursorSource::EvdevCursorSource(QObject *parent)
+    : CursorSource(parent)
+{
+}
+
+EvdevCursorSource::~EvdevCursorSource()
+{
+    stop();
+}
+
+std::vector<int> EvdevCursorSource::openPointerDevices()
+{
+    std::vector<int> fds;
+    const QStringList entries = QDir(QStringLiteral("/dev/input")).entryList({ QStringLiteral("event*") }, QDir::System);
+    for (const QString& entry : entries) {
+        const QByteArray path = QByteArrayLiteral("/dev/input/") + entry.toLocal8Bit();
+        const int fd = ::open(path.constData(), O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+        if (fd < 0) continue;
+
+        if (isPointerDevice(fd)) {
+            fds.push_back(fd);
+        } else {
+            ::close(fd);
+        }
+    }
+    return fds;
+}
+
+bool EvdevCursorSource::isSupported()
+{
+    const std::vector<int> fds = openPointerDevices();
+    for (int fd : fds) {
+        ::close(fd);
+    }
+    return !fds.empty();
+}
+
+bool EvdevCursorSource::start()
+{
+    if (isActive()) return true;
+
+    const std::vector<int> fds = openPointerDevices();
+    if (fds.empty()) return false;
+
+    // Reserve up front, the notifier lambdas keep pointers into the vector
+    m_devices.reserve(fds.size());
+    for (int fd : fds) {
+        m_devices.emplace_back();
+        Device& device = m_devices.back();
+        device.fd = fd;
+        device.notifier = new QSocketNotifier(fd, QSocketNotifier::Read, this);
+        connect(device.notifier, &QSocketNotifier::activated, this, [this, &device]() {
+            readDevice(device);
+        });
+    }
+
+    setActive(true);
+    return true;
+}
+
+void EvdevCursorSource::stop()
+{
+    if (!isActive()) return;
+
+    for (Device& device : m_devices) {
+        delete device.notifier;
+        ::close(device.fd);
+    }
+    m_devices.clear();
+    setActive(false);
+}
+
+void EvdevCursorSource::readDevice(Device& device)
+{
+    input_event events[64];
+    for (;;) {
+        const ssize_t bytes = ::read(device.fd, events, sizeof(events));
+        if (bytes <= 0) {
+            // Unplugged devices report ENODEV, stop watching them
+            if (bytes == 0 || errno == ENODEV) {
+                device.notifier->setEnabled(false);
+            }
+            return;
+        }
+
+        const size_t count = size_t(bytes) / sizeof(input_event);
+        for (size_t i = 0; i < count; ++i) {
+            const input_event& event = events[i];
+            // Wheel and pressure changes do not move the pointer
+            if ((event.type == EV_REL && (event.code == REL_X || event.code == REL_Y))
+                || (event.type == EV_ABS && (event.code == ABS_X || event.code == ABS_Y))) {
+                device.moved = true;
+            } else if (event.type == EV_SYN && event.code == SYN_REPORT && device.moved) {
+                device.moved = false;
+                reportMotion();
+            }
+        }
+    }
+}
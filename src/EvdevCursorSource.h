@@ -0,0 +1,65 @@
+/*
+ * MouseCross - A crosshair overlay application for visually impaired users
+ * Copyright (C) 2025 Stefan Lohmaier <stefan@slohmaier.de>
+ *
+ * This file is part of MouseCross.
+ *
+ * MouseCross is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MouseCross is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with MouseCross. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Project website: https://slohmaier.de/mousecross
+ */
+
+#ifndef EVDEVCURSORSOURCE_H
+#define EVDEVCURSORSOURCE_H
+
+#include "CursorSource.h"
+#include <vector>
+
+class QSocketNotifier;
+
+// Reads pointer devices from /dev/input directly, for setups where the user
+// may open them (usually membership in the input group). Gaming mice and pen
+// tablets report at up to 1000 Hz; every SYN_REPORT with motion is passed on
+// and coalesced to one sample per frame. Pointer acceleration is applied by
+// the display server, so the position itself is still read from there.
+// Devices plugged in after start() are not picked up.
+class EvdevCursorSource : public CursorSource
+{
+    Q_OBJECT
+
+public:
+    explicit EvdevCursorSource(QObject *parent = nullptr);
+    ~EvdevCursorSource() override;
+
+    // True when at least one pointer device can be opened
+    static bool isSupported();
+
+    QString name() const override { return QStringLiteral("evdev"); }
+    bool start() override;
+    void stop() override;
+
+private:
+    struct Device {
+        int fd = -1;
+        QSocketNotifier* notifier = nullptr;
+        bool moved = false;
+    };
+
+    static std::vector<int> openPointerDevices();
+    void readDevice(Device& device);
+
+    std::vector<Device> m_devices;
+};
+
+#endif // EVDEVCURSORSOURCE_H
@@ -0,0 +1,113 @@
+/*
+ * MouseCross - A crosshair overlay application for visually impaired users
+ * Copyright (C) 2025 Stefan Lohmaier <stefan@slohmaier.de>
+ *
+ * This file is part of MouseCross.
+ *
+ * MouseCross is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MouseCross is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with MouseCross. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Project website: https://slohmaier.de/mousecross
+ */
+
+#include "FrameScheduler.h"
+#include <QTimer>
+
+namespace {
+
+const qint64 NsPerMs = 1000 * 1000;
+const qint64 NsPerSecond = 1000 * NsPerMs;
+
+}
+
+FrameScheduler::FrameScheduler(std::unique_ptr<FrameClock> clock, QObject *parent)
+    : QObject(parent)
+    , m_clock(clock ? std::move(clock) : std::make_unique<SteadyFrameClock>())
+    , m_timer(new QTimer(this))
+    , m_refreshRate(0)
+    , m_rateCap(0)
+    , m_interval(0)
+    , m_phase(0)
+    , m_lastFrame(-1)
+    , m_pendingTarget(0)
+{
+    m_timer->setSingleShot(true);
+    // The default coarse timer may fire up to 5% late, a visible stutter at 144 Hz
+    m_timer->setTimerType(Qt::PreciseTimer);
+    connect(m_timer, &QTimer::timeout, this, &FrameScheduler::emitFrame);
+    setRefreshRate(60.0);
+}
+
+FrameScheduler::~FrameScheduler() = default;
+
+void FrameScheduler::setRefreshRate(qreal hz)
+{
+    // Some drivers report 0 Hz, remote sessions anything from 1 to 60
+    if (hz < 1.0 || hz > 1000.0) hz = 60.0;
+    if (qFuzzyCompare(hz, m_refreshRate)) return;
+
+    m_refreshRate = hz;
+    updateInterval();
+}
+
+void FrameScheduler::setRateCap(qreal hz)
+{
+    m_rateCap = qMax<qreal>(0, hz);
+    updateInterval();
+}
+
+void FrameScheduler::updateInterval()
+{
+    const qreal rate = m_rateCap > 0 ? qMin(m_refreshRate, m_rateCap) : m_refreshRate;
+    m_interval = qRound64(NsPerSecond / rate);
+}
+
+int FrameScheduler::frameIntervalMs() const
+{
+    return static_cast<int>(qMax<qint64>(1, (m_interval + NsPerMs / 2) / NsPerMs));
+}
+
+void FrameScheduler::requestFrame()
+{
+    if (m_timer->isActive()) return;
+
+    const qint64 now = m_clock->now();
+
+    // Idle for a while, start a new grid at this frame
+    if (m_lastFrame < 0 || now - m_lastFrame > 2 * m_interval) {
+        m_phase = now;
+        m_pendingTarget = now;
+        m_timer->start(0);
+        return;
+    }
+
+    // Next refresh on the grid that has not had a frame yet
+    qint64 target = m_phase + ((now - m_phase + m_interval - 1) / m_interval) * m_interval;
+    if (target <= m_lastFrame) {
+        target = m_lastFrame + m_interval;
+    }
+    m_pendingTarget = target;
+    m_timer->start(static_cast<int>((target - now + NsPerMs / 2) / NsPerMs));
+}
+
+void FrameScheduler::cancel()
+{
+    m_timer->stop();
+    m_lastFrame = -1;
+}
+
+void FrameScheduler::emitFrame()
+{
+    m_lastFrame = m_pendingTarget;
+    emit frameDue(m_pendingTarget);
+}
@@ -0,0 +1,96 @@
+/*
+ * MouseCross - A crosshair overlay application for visually impaired users
+ * Copyright (C) 2025 Stefan Lohmaier <stefan@slohmaier.de>
+ *
+ * This file is part of MouseCross.
+ *
+ * MouseCross is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MouseCross is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with MouseCross. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Project website: https://slohmaier.de/mousecross
+ */
+
+#ifndef FRAMESCHEDULER_H
+#define FRAMESCHEDULER_H
+
+#include <QObject>
+#include <QElapsedTimer>
+#include <memory>
+
+class QTimer;
+
+// Monotonic time source in nanoseconds, replaceable for deterministic timing
+class FrameClock
+{
+public:
+    virtual ~FrameClock() = default;
+    virtual qint64 now() const = 0;
+};
+
+class SteadyFrameClock : public FrameClock
+{
+public:
+    SteadyFrameClock() { m_timer.start(); }
+    qint64 now() const override { return m_timer.nsecsElapsed(); }
+
+private:
+    QElapsedTimer m_timer;
+};
+
+// Paces cursor updates to the display refresh. Any number of requestFrame()
+// calls between two refreshes result in a single frameDue(), emitted on a grid
+// of refresh intervals. After an idle period the first frame is emitted right
+// away and starts a new grid, so the first move is not delayed.
+class FrameScheduler : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit FrameScheduler(std::unique_ptr<FrameClock> clock = nullptr, QObject *parent = nullptr);
+    ~FrameScheduler() override;
+
+    // Target rate, normally QScreen::refreshRate() of the cursor's screen
+    void setRefreshRate(qreal hz);
+    qreal refreshRate() const { return m_refreshRate; }
+    // Upper bound for the frame rate regardless of the refresh, 0 for none
+    void setRateCap(qreal hz);
+    qreal rateCap() const { return m_rateCap; }
+    qint64 frameInterval() const { return m_interval; }
+    int frameIntervalMs() const;
+
+    const FrameClock* clock() const { return m_clock.get(); }
+
+    void requestFrame();
+    void cancel();
+
+signals:
+    // targetTime is the refresh the frame is meant for, on clock()
+    void frameDue(qint64 targetTime);
+
+private slots:
+    void emitFrame();
+
+private:
+    void updateInterval();
+
+    std::unique_ptr<FrameClock> m_clock;
+    QTimer* m_timer;
+    qreal m_refreshRate;
+    qreal m_rateCap;
+    qint64 m_interval;
+    qint64 m_phase;
+    qint64 m_lastFrame;
+    qint64 m_pendingTarget;
+};
+
+#endif // FRAMESCHEDULER_H
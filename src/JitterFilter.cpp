@@ -0,0 +1,97 @@
+/*
+ * MouseCross - A crosshair overlay application for visually impaired users
+ * Copyright (C) 2025 Stefan Lohmaier <stefan@slohmaier.de>
+ *
+ * This file is part of MouseCross.
+ *
+ * MouseCross is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MouseCross is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with MouseCross. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Project website: https://slohmaier.de/mousecross
+ */
+
+#include "JitterFilter.h"
+#include <QtMath>
+
+namespace {
+
+// Cutoff in Hz while the pointer barely moves, and how fast it rises with speed
+// in px/s. Tuned so 50 px/s is smoothed over a few frames and 1000 px/s lags < 1 frame.
+const double MinCutoff = 1.5;
+const double Beta = 0.05;
+const double DerivativeCutoff = 1.0;
+
+double smoothingFactor(double cutoff, double dt)
+{
+    const double tau = 1.0 / (2.0 * M_PI * cutoff);
+    return 1.0 / (1.0 + tau / dt);
+}
+
+}
+
+JitterFilter::JitterFilter()
+    : m_enabled(true)
+    , m_deadZone(2)
+    , m_initialized(false)
+    , m_lastTimestamp(0)
+{
+}
+
+void JitterFilter::setEnabled(bool enabled)
+{
+    if (m_enabled == enabled) return;
+    m_enabled = enabled;
+    reset();
+}
+
+void JitterFilter::reset()
+{
+    m_initialized = false;
+}
+
+double JitterFilter::filterAxis(Axis& axis, double raw, double dt) const
+{
+    const double derivative = (raw - axis.value) / dt;
+    axis.derivative += smoothingFactor(DerivativeCutoff, dt) * (derivative - axis.derivative);
+
+    const double cutoff = MinCutoff + Beta * qAbs(axis.derivative);
+    axis.value += smoothingFactor(cutoff, dt) * (raw - axis.value);
+    return axis.value;
+}
+
+void JitterFilter::filter(CursorSample& sample)
+{
+    if (!m_enabled) return;
+
+    const double dt = (sample.timestamp - m_lastTimestamp) / 1e9;
+    // First sample, or the pointer rested long enough that the old state is stale
+    if (!m_initialized || dt <= 0.0 || dt > 0.5) {
+        m_x = { double(sample.pos.x()), 0.0 };
+        m_y = { double(sample.pos.y()), 0.0 };
+        m_lastTimestamp = sample.timestamp;
+        m_initialized = true;
+        return;
+    }
+    m_lastTimestamp = sample.timestamp;
+
+    sample.pos = QPoint(qRound(filterAxis(m_x, sample.pos.x(), dt)),
+                        qRound(filterAxis(m_y, sample.pos.y(), dt)));
+}
+
+bool JitterFilter::exceedsDeadZone(const QPoint& shown, const QPoint& pos) const
+{
+    if (!m_enabled) return shown != pos;
+    const QPoint delta = pos - shown;
+    return delta.x() * delta.x() + delta.y() * delta.y() >= m_deadZone * m_deadZone
+           && delta != QPoint();
+}
@@ -0,0 +1,69 @@
+/*
+ * MouseCross - A crosshair overlay application for visually impaired users
+ * Copyright (C) 2025 Stefan Lohmaier <stefan@slohmaier.de>
+ *
+ * This file is part of MouseCross.
+ *
+ * MouseCross is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MouseCross is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with MouseCross. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Project website: https://slohmaier.de/mousecross
+ */
+
+#ifndef JITTERFILTER_H
+#define JITTERFILTER_H
+
+#include <QPoint>
+#include "CursorSource.h"
+
+// Adaptive low-pass filter for cursor samples (One Euro filter, Casiez et al.
+// 2012) plus a dead zone. Slow movement such as tremor or high-DPI sensor
+// noise is smoothed strongly, fast movement passes with little lag. Moves
+// that stay inside the dead zone around the shown position are not drawn.
+class JitterFilter
+{
+public:
+    JitterFilter();
+
+    void setEnabled(bool enabled);
+    bool isEnabled() const { return m_enabled; }
+
+    // Radius in pixels around the shown position that does not cause a repaint
+    void setDeadZone(int pixels) { m_deadZone = qMax(0, pixels); }
+    int deadZone() const { return m_deadZone; }
+
+    void reset();
+
+    // Replaces the sample position with the filtered one
+    void filter(CursorSample& sample);
+
+    // True when moving the crosshair from shown to pos is worth a repaint
+    bool exceedsDeadZone(const QPoint& shown, const QPoint& pos) const;
+
+private:
+    struct Axis {
+        double value = 0.0;
+        double derivative = 0.0;
+    };
+
+    double filterAxis(Axis& axis, double raw, double dt) const;
+
+    bool m_enabled;
+    int m_deadZone;
+    bool m_initialized;
+    qint64 m_lastTimestamp;
+    Axis m_x;
+    Axis m_y;
+};
+
+#endif // JITTERFILTER_H
@@ -24,7 +24,6 @@
 #define MACOSCROSSHAIRRENDERER_H
 
 #include "CrosshairRenderer.h"
-#include <QTimer>
 #include <memory>
 
 #ifdef __OBJC__
@@ -53,14 +52,12 @@ public:
     bool isRendering() const override { return m_isRendering; }
     
 private slots:
-    void updateCrosshair();
     void handleScreenConfigurationChanged();
 
 private:
     void updateWindowFrame();
 
     CrosshairView* m_view;
-    QTimer* m_updateTimer;
     void* m_window; // NSWindow*
     void* m_screenChangeObserver; // NSNotificationCenter observer
 };
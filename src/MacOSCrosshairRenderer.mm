@@ -410,7 +410,6 @@
 
 MacOSCrosshairRenderer::MacOSCrosshairRenderer()
     : m_view(nil)
-    , m_updateTimer(nullptr)
     , m_window(nil)
     , m_screenChangeObserver(nil)
 {
@@ -452,10 +451,6 @@ bool MacOSCrosshairRenderer::initialize()
         // Store window reference
         m_window = (__bridge void*)window;
         [window retain];
-        
-        // Setup update timer
-        m_updateTimer = new QTimer(this);
-        connect(m_updateTimer, &QTimer::timeout, this, &MacOSCrosshairRenderer::updateCrosshair);
 
         // Setup screen configuration change detection
         NSNotificationCenter *nc = [NSNotificationCenter defaultCenter];
@@ -476,11 +471,6 @@ void MacOSCrosshairRenderer::cleanup()
 {
     stopRendering();
 
-    if (m_updateTimer) {
-        delete m_updateTimer;
-        m_updateTimer = nullptr;
-    }
-
     @autoreleasepool {
         // Remove screen change observer
         if (m_screenChangeObserver) {
@@ -513,21 +503,16 @@ void MacOSCrosshairRenderer::startRendering()
         [window makeKeyAndOrderFront:nil];
     }
     
-    if (m_updateTimer) {
-        m_updateTimer->start(16); // ~60 FPS
-    }
-    
     m_isRendering = true;
+    
+    // Draw at the current position, the cursor source only reports movement
+    updateMousePosition(QCursor::pos());
 }
 
 void MacOSCrosshairRenderer::stopRendering()
 {
     if (!m_isRendering) return;
     
-    if (m_updateTimer) {
-        m_updateTimer->stop();
-    }
-    
     @autoreleasepool {
         NSWindow *window = (__bridge NSWindow*)m_window;
         [window orderOut:nil];
@@ -561,14 +546,7 @@ void MacOSCrosshairRenderer::updateMousePosition(const QPoint& pos)
             [m_view updateMousePosition:pos];
         }
     }
-}
-
-void MacOSCrosshairRenderer::updateCrosshair()
-{
-    QPoint newPos = QCursor::pos();
-    if (newPos != m_mousePos) {
-        updateMousePosition(newPos);
-    }
+    notifyFramePresented();
 }
 
 void MacOSCrosshairRenderer::handleScreenConfigurationChanged()
@@ -0,0 +1,100 @@
+/*
+ * MouseCross - A crosshair overlay application for visually impaired users
+ * Copyright (C) 2025 Stefan Lohmaier <stefan@slohmaier.de>
+ *
+ * This file is part of MouseCross.
+ *
+ * MouseCross is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MouseCross is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with MouseCross. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Project website: https://slohmaier.de/mousecross
+ */
+
+#include "MotionPredictor.h"
+#include <QtMath>
+
+namespace {
+
+// Below this speed the pointer is being positioned precisely, show it as is
+const qreal MinSpeed = 200.0;            // px/s
+// Turns sharper than ~60 degrees between two samples count as a direction change
+const qreal SharpTurnCosine = 0.5;
+const int SuppressFramesAfterTurn = 3;
+// Bounds for the look-ahead and the extrapolated distance
+const qint64 MaxHorizon = 50 * 1000 * 1000;
+const qreal MaxOffset = 64.0;            // px
+
+}
+
+MotionPredictor::MotionPredictor()
+    : m_enabled(false)
+    , m_latency(0)
+    , m_suppressedFrames(0)
+{
+}
+
+void MotionPredictor::setEnabled(bool enabled)
+{
+    if (m_enabled == enabled) return;
+    m_enabled = enabled;
+    reset();
+}
+
+void MotionPredictor::reset()
+{
+    m_lastVelocity = QPointF();
+    m_suppressedFrames = 0;
+}
+
+void MotionPredictor::addLatencySample(qint64 nanoseconds)
+{
+    if (nanoseconds <= 0 || nanoseconds > MaxHorizon) return;
+    // Exponential moving average, follows load changes within a few dozen frames
+    m_latency = m_latency == 0 ? nanoseconds : (m_latency * 7 + nanoseconds) / 8;
+}
+
+QPoint MotionPredictor::predict(const CursorSample& sample, qint64 horizon)
+{
+    const QPointF velocity = sample.velocity;
+    const QPointF previous = m_lastVelocity;
+    m_lastVelocity = velocity;
+
+    if (!m_enabled) return sample.pos;
+
+    const qreal speed = qSqrt(QPointF::dotProduct(velocity, velocity));
+    const qreal previousSpeed = qSqrt(QPointF::dotProduct(previous, previous));
+    if (speed < MinSpeed) {
+        m_suppressedFrames = 0;
+        return sample.pos;
+    }
+
+    // A turn makes the old direction worthless, overshooting it is worse than lagging
+    if (previousSpeed >= MinSpeed) {
+        const qreal cosine = QPointF::dotProduct(velocity, previous) / (speed * previousSpeed);
+        if (cosine < SharpTurnCosine) {
+            m_suppressedFrames = SuppressFramesAfterTurn;
+        }
+    }
+    if (m_suppressedFrames > 0) {
+        --m_suppressedFrames;
+        return sample.pos;
+    }
+
+    const qreal seconds = qMin(horizon, MaxHorizon) / 1e9;
+    QPointF offset = velocity * seconds;
+    const qreal length = qSqrt(QPointF::dotProduct(offset, offset));
+    if (length > MaxOffset) {
+        offset *= MaxOffset / length;
+    }
+    return sample.pos + offset.toPoint();
+}
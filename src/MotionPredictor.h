@@ -0,0 +1,57 @@
+/*
+ * MouseCross - A crosshair overlay application for visually impaired users
+ * Copyright (C) 2025 Stefan Lohmaier <stefan@slohmaier.de>
+ *
+ * This file is part of MouseCross.
+ *
+ * MouseCross is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MouseCross is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with MouseCross. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Project website: https://slohmaier.de/mousecross
+ */
+
+#ifndef MOTIONPREDICTOR_H
+#define MOTIONPREDICTOR_H
+
+#include <QPoint>
+#include <QPointF>
+#include "CursorSource.h"
+
+// Constant-velocity extrapolation of the cursor to the time the frame is
+// expected on screen, so the crosshair does not trail a fast pointer. The
+// look-ahead is the measured render latency plus the presentation delay.
+// Prediction pauses for a few frames after sharp direction changes and is
+// skipped for slow movement, where it would only add overshoot and jitter.
+class MotionPredictor
+{
+public:
+    MotionPredictor();
+
+    void setEnabled(bool enabled);
+    bool isEnabled() const { return m_enabled; }
+    void reset();
+
+    // Smoothed time from a sample to its frame being drawn
+    void addLatencySample(qint64 nanoseconds);
+    qint64 latency() const { return m_latency; }
+
+    QPoint predict(const CursorSample& sample, qint64 horizon);
+
+private:
+    bool m_enabled;
+    qint64 m_latency;
+    QPointF m_lastVelocity;
+    int m_suppressedFrames;
+};
+
+#endif // MOTIONPREDICTOR_H
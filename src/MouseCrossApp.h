@@ -37,11 +37,14 @@
 
 class QMenu;
 class QAction;
+class QTranslator;
 class CrosshairOverlay;
 class WelcomeDialog;
 class SettingsDialog;
 class AboutDialog;
 class SettingsManager;
+class X11GlobalHotkey;
+class ControlServer;
 
 class MouseCrossApp : public QWidget
 {
@@ -60,13 +63,21 @@ private slots:
     void quit();
     void trayIconActivated(QSystemTrayIcon::ActivationReason reason);
     void onHotkeyPressed();
+    void onHotkeyReleased();
     void updateCrosshairFromSettings();
+    void finishStartup();
 
 private:
     void createTrayIcon();
+    void createTrayMenu();
     void createActions();
+    void loadTranslations();
+    CrosshairOverlay* crosshair();
+    QString handleControlCommand(const QString& command, const QStringList& args);
+    QString controlStats() const;
     void setupHotkey();
     void showWelcomeIfFirstRun();
+    bool isMomentaryHotkey() const;
     
 #ifdef Q_OS_WIN
     bool nativeEvent(const QByteArray &eventType, void *message, qintptr *result) override;
@@ -80,11 +91,19 @@ private:
     void unregisterHotkey();
     void updateHotkey();
 #endif
+
+#if defined(HAVE_X11) && defined(HAVE_XCB)
+    void registerHotkey();
+    void unregisterHotkey();
+    void updateHotkey();
+#endif
     
     std::unique_ptr<QSystemTrayIcon> m_trayIcon;
     std::unique_ptr<QMenu> m_trayMenu;
     std::unique_ptr<CrosshairOverlay> m_crosshair;
     std::unique_ptr<SettingsManager> m_settings;
+    QTranslator* m_translator;
+    ControlServer* m_controlServer;
     
     QAction* m_toggleAction;
     QAction* m_settingsAction;
@@ -102,6 +121,10 @@ private:
     static MouseCrossApp* s_instance;
     static OSStatus hotKeyHandler(EventHandlerCallRef nextHandler, EventRef theEvent, void* userData);
 #endif
+
+#if defined(HAVE_X11) && defined(HAVE_XCB)
+    std::unique_ptr<X11GlobalHotkey> m_x11Hotkey;
+#endif
 };
 
 #endif // MOUSECROSSAPP_H
\ No newline at end of file
@@ -0,0 +1,173 @@
+/*
+ * MouseCross - A crosshair overlay application for visually impaired users
+ * Copyright (C) 2025 Stefan Lohmaier <stefan@slohmaier.de>
+ *
+ * This file is part of MouseCross.
+ *
+ * MouseCross is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MouseCross is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with MouseCross. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Project website: https://slohmaier.de/mousecross
+ */
+
+#include "PollingCursorSource.h"
+#include "FrameScheduler.h"
+#include <QCursor>
+#include <QTimer>
+
+#ifdef HAVE_XCB
+#include "X11Support.h"
+#include <xcb/xcb.h>
+#include <cstdlib>
+#endif
+
+PollingCursorSource::PollingCursorSource(QObject *parent)
+    : CursorSource(parent)
+    , m_pollTimer(new QTimer(this))
+    , m_idleIntervals({ 50, 250 })
+    , m_idleTicks(30)
+    , m_idleLevel(0)
+    , m_stillTicks(0)
+    , m_pipelined(false)
+    , m_queryPending(false)
+    , m_querySequence(0)
+{
+    connect(m_pollTimer, &QTimer::timeout, this, &PollingCursorSource::poll);
+}
+
+bool PollingCursorSource::start()
+{
+#ifdef HAVE_XCB
+    m_pipelined = X11Support::connection() != nullptr;
+#endif
+    setActive(true);
+    m_pollTimer->setTimerType(Qt::PreciseTimer);
+    m_stillTicks = 0;
+    setIdleLevel(0);
+    m_pollTimer->start();
+    if (m_pipelined) {
+        sendQuery();
+    }
+    return true;
+}
+
+void PollingCursorSource::stop()
+{
+    m_pollTimer->stop();
+    discardQuery();
+    setActive(false);
+}
+
+void PollingCursorSource::setIdleBackoff(const QList<int>& intervals, int stillTicks)
+{
+    m_idleIntervals = intervals;
+    m_idleTicks = qMax(1, stillTicks);
+    if (m_idleLevel > m_idleIntervals.size()) {
+        setIdleLevel(m_idleIntervals.size());
+    }
+}
+
+void PollingCursorSource::setIdleLevel(int level)
+{
+    m_idleLevel = level;
+    int interval = frameScheduler() ? frameScheduler()->frameIntervalMs() : 16;
+    if (level > 0) {
+        interval = qMax(interval, m_idleIntervals.at(level - 1));
+    }
+    // setInterval() restarts a running timer with the new period
+    if (m_pollTimer->interval() != interval) {
+        m_pollTimer->setInterval(interval);
+    }
+}
+
+void PollingCursorSource::poll()
+{
+    QPoint pos;
+    if (m_pipelined) {
+        // Reply still in flight on a slow link, try again next tick instead of waiting
+        QPoint nativePos;
+        if (!collectReply(&nativePos)) return;
+        sendQuery();
+#ifdef HAVE_XCB
+        pos = X11Support::fromNativePixels(nativePos);
+#endif
+    } else {
+        pos = QCursor::pos();
+    }
+
+    if (pos != m_lastPolledPos) {
+        m_lastPolledPos = pos;
+        m_stillTicks = 0;
+        if (m_idleLevel != 0) {
+            setIdleLevel(0);
+        }
+        reportPosition(pos);
+    } else if (++m_stillTicks >= m_idleTicks && m_idleLevel < m_idleIntervals.size()) {
+        // Step down one level at a time, a short pause keeps a fairly fast poll
+        m_stillTicks = 0;
+        setIdleLevel(m_idleLevel + 1);
+    }
+}
+
+void PollingCursorSource::sendQuery()
+{
+#ifdef HAVE_XCB
+    xcb_connection_t* connection = X11Support::connection();
+    const xcb_query_pointer_cookie_t cookie =
+        xcb_query_pointer(connection, static_cast<xcb_window_t>(X11Support::rootWindow()));
+    xcb_flush(connection);
+    m_querySequence = cookie.sequence;
+    m_queryPending = true;
+#endif
+}
+
+bool PollingCursorSource::collectReply(QPoint* nativePos)
+{
+#ifdef HAVE_XCB
+    if (!m_queryPending) {
+        sendQuery();
+        return false;
+    }
+
+    void* reply = nullptr;
+    xcb_generic_error_t* error = nullptr;
+    if (!xcb_poll_for_reply(X11Support::connection(), m_querySequence, &reply, &error)) {
+        return false;
+    }
+    m_queryPending = false;
+
+    if (error || !reply) {
+        std::free(error);
+        sendQuery();
+        return false;
+    }
+
+    auto* pointer = static_cast<xcb_query_pointer_reply_t*>(reply);
+    *nativePos = QPoint(pointer->root_x, pointer->root_y);
+    std::free(reply);
+    return true;
+#else
+    Q_UNUSED(nativePos);
+    return false;
+#endif
+}
+
+void PollingCursorSource::discardQuery()
+{
+#ifdef HAVE_XCB
+    if (m_queryPending) {
+        xcb_discard_reply(X11Support::connection(), m_querySequence);
+    }
+#endif
+    m_queryPending = false;
+}
@@ -0,0 +1,69 @@
+/*
+ * MouseCross - A crosshair overlay application for visually impaired users
+ * Copyright (C) 2025 Stefan Lohmaier <stefan@slohmaier.de>
+ *
+ * This file is part of MouseCross.
+ *
+ * MouseCross is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MouseCross is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with MouseCross. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Project website: https://slohmaier.de/mousecross
+ */
+
+#ifndef POLLINGCURSORSOURCE_H
+#define POLLINGCURSORSOURCE_H
+
+#include "CursorSource.h"
+#include <QList>
+
+class QTimer;
+
+// Reads the pointer position once per frame interval. Works everywhere, used
+// when no event-driven source is available. On X11 the query is pipelined: each
+// tick collects the reply to the previous tick's xcb_query_pointer and sends the
+// next one, so the GUI thread never waits for a round trip (e.g. over Xvnc).
+// While the pointer rests the poll steps down through the idle intervals and
+// returns to the frame rate on the first move.
+class PollingCursorSource : public CursorSource
+{
+    Q_OBJECT
+
+public:
+    explicit PollingCursorSource(QObject *parent = nullptr);
+
+    QString name() const override { return QStringLiteral("polling"); }
+    bool start() override;
+    void stop() override;
+    void setIdleBackoff(const QList<int>& intervals, int stillTicks) override;
+
+private slots:
+    void poll();
+
+private:
+    void sendQuery();
+    bool collectReply(QPoint* nativePos);
+    void discardQuery();
+    void setIdleLevel(int level);
+
+    QTimer* m_pollTimer;
+    QList<int> m_idleIntervals;
+    int m_idleTicks;
+    int m_idleLevel;
+    int m_stillTicks;
+    QPoint m_lastPolledPos;
+    bool m_pipelined;
+    bool m_queryPending;
+    unsigned int m_querySequence;
+};
+
+#endif // POLLINGCURSORSOURCE_H
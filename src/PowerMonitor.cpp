@@ -0,0 +1,154 @@
+/*
+ * MouseCross - A crosshair overlay application for visually impaired users
+ * Copyright (C) 2025 Stefan Lohmaier <stefan@slohmaier.de>
+ *
+ * This file is part of MouseCross.
+ *
+ * MouseCross is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MouseCross is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with MouseCross. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Project website: https://slohmaier.de/mousecross
+ */
+
+#include "PowerMonitor.h"
+#include "Logging.h"
+#include <QTimer>
+#include <QDir>
+#include <QFile>
+
+#ifdef HAVE_QTDBUS
+#include <QDBusConnection>
+#endif
+
+#ifdef Q_OS_WIN
+#include <windows.h>
+#endif
+
+namespace {
+
+// Unplugging is rarely urgent, a slow poll catches it without a bus
+const int PollIntervalMs = 30 * 1000;
+
+#ifdef Q_OS_LINUX
+QByteArray readSysfs(const QString& path)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) return QByteArray();
+    return file.readAll().trimmed();
+}
+#endif
+
+}
+
+PowerMonitor::PowerMonitor(QObject *parent)
+    : QObject(parent)
+    , m_pollTimer(new QTimer(this))
+    , m_active(false)
+    , m_onBattery(false)
+{
+    m_pollTimer->setInterval(PollIntervalMs);
+    m_pollTimer->setTimerType(Qt::VeryCoarseTimer);
+    connect(m_pollTimer, &QTimer::timeout, this, &PowerMonitor::refresh);
+}
+
+PowerMonitor::~PowerMonitor()
+{
+    stop();
+}
+
+void PowerMonitor::start()
+{
+    if (m_active) return;
+    m_active = true;
+    connectUPower(true);
+    m_pollTimer->start();
+    refresh();
+}
+
+void PowerMonitor::stop()
+{
+    if (!m_active) return;
+    m_active = false;
+    connectUPower(false);
+    m_pollTimer->stop();
+
+    // Nothing is known while not watching, the next start() reports battery afresh
+    m_onBattery = false;
+}
+
+void PowerMonitor::refresh()
+{
+    const bool onBattery = readOnBattery();
+    if (onBattery == m_onBattery) return;
+
+    m_onBattery = onBattery;
+    qCDebug(lcDiagnostics) << "Running on" << (onBattery ? "battery" : "mains power");
+    emit onBatteryChanged(onBattery);
+}
+
+void PowerMonitor::handleUPowerChanged(const QString& interface, const QVariantMap& changed,
+                                       const QStringList& invalidated)
+{
+    Q_UNUSED(interface);
+    if (changed.contains(QStringLiteral("OnBattery")) || invalidated.contains(QStringLiteral("OnBattery"))) {
+        refresh();
+    }
+}
+
+void PowerMonitor::connectUPower(bool enabled)
+{
+#ifdef HAVE_QTDBUS
+    QDBusConnection system = QDBusConnection::systemBus();
+    const QString service = QStringLiteral("org.freedesktop.UPower");
+    const QString path = QStringLiteral("/org/freedesktop/UPower");
+    const QString interface = QStringLiteral("org.freedesktop.DBus.Properties");
+    const QString signal = QStringLiteral("PropertiesChanged");
+    if (enabled) {
+        system.connect(service, path, interface, signal, this,
+                       SLOT(handleUPowerChanged(QString,QVariantMap,QStringList)));
+    } else {
+        system.disconnect(service, path, interface, signal, this,
+                          SLOT(handleUPowerChanged(QString,QVariantMap,QStringList)));
+    }
+#else
+    Q_UNUSED(enabled);
+#endif
+}
+
+bool PowerMonitor::readOnBattery()
+{
+#if defined(Q_OS_LINUX)
+    // On battery means a system battery is discharging and no mains supply is
+    // online. Batteries of wireless mice and keyboards report scope "Device".
+    const QString base = QStringLiteral("/sys/class/power_supply");
+    const QStringList supplies = QDir(base).entryList(QDir::Dirs | QDir::NoDotAndDotDot);
+    bool discharging = false;
+    for (const QString& supply : supplies) {
+        const QString path = base + QLatin1Char('/') + supply;
+        const QByteArray type = readSysfs(path + QStringLiteral("/type"));
+        if (type == "Mains" || type == "USB") {
+            if (readSysfs(path + QStringLiteral("/online")) == "1") return false;
+        } else if (type == "Battery" && readSysfs(path + QStringLiteral("/scope")) != "Device") {
+            if (readSysfs(path + QStringLiteral("/status")) == "Discharging") {
+                discharging = true;
+            }
+        }
+    }
+    return discharging;
+#elif defined(Q_OS_WIN)
+    SYSTEM_POWER_STATUS status;
+    return GetSystemPowerStatus(&status) && status.ACLineStatus == 0;
+#else
+    return false;
+#endif
+}
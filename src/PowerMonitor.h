@@ -0,0 +1,68 @@
+/*
+ * MouseCross - A crosshair overlay application for visually impaired users
+ * Copyright (C) 2025 Stefan Lohmaier <stefan@slohmaier.de>
+ *
+ * This file is part of MouseCross.
+ *
+ * MouseCross is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MouseCross is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with MouseCross. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Project website: https://slohmaier.de/mousecross
+ */
+
+#ifndef POWERMONITOR_H
+#define POWERMONITOR_H
+
+#include <QObject>
+#include <QVariantMap>
+#include <QStringList>
+
+class QTimer;
+
+// Tells whether the machine runs on battery. On Linux the state is read from
+// /sys/class/power_supply, so no D-Bus is needed; when Qt D-Bus is available
+// UPower's change notifications trigger an immediate re-read.
+class PowerMonitor : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit PowerMonitor(QObject *parent = nullptr);
+    ~PowerMonitor() override;
+
+    void start();
+    void stop();
+    bool isActive() const { return m_active; }
+
+    // False while stopped
+    bool onBattery() const { return m_onBattery; }
+
+    // Reads the current state from the system
+    static bool readOnBattery();
+
+signals:
+    void onBatteryChanged(bool onBattery);
+
+private slots:
+    void refresh();
+    void handleUPowerChanged(const QString& interface, const QVariantMap& changed, const QStringList& invalidated);
+
+private:
+    void connectUPower(bool enabled);
+
+    QTimer* m_pollTimer;
+    bool m_active;
+    bool m_onBattery;
+};
+
+#endif // POWERMONITOR_H
@@ -0,0 +1,161 @@
+/*
+ * MouseCross - A crosshair overlay application for visually impaired users
+ * Copyright (C) 2025 Stefan Lohmaier <stefan@slohmaier.de>
+ *
+ * This file is part of MouseCross.
+ *
+ * MouseCross is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MouseCross is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with MouseCross. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Project website: https://slohmaier.de/mousecross
+ */
+
+#include "QualityGovernor.h"
+#include "RenderCostModel.h"
+
+namespace {
+
+// Frames may use this share of the budget, the rest is left for the compositor
+const double BudgetShare = 0.8;
+
+// Consecutive overruns before stepping down, a single slow frame is noise
+const int OverBudgetFrames = 8;
+
+// Frames the better level must be predicted to fit in before stepping up,
+// about two seconds at 60 Hz, and the share of the budget it must fit in
+const int HeadroomFrames = 120;
+const double HeadroomShare = 0.5;
+
+// Weight of a new measurement in the time per cost unit
+const double Smoothing = 0.1;
+
+// Taper steps of the coarse level
+const int CoarseTaperSegments = 12;
+
+}
+
+QualityGovernor::QualityGovernor()
+    : m_enabled(true)
+    , m_level(Full)
+    , m_lowestLevel(CoarseTaper)
+    , m_units{}
+    , m_nsPerUnit(0.0)
+    , m_overBudgetFrames(0)
+    , m_headroomFrames(0)
+{
+}
+
+void QualityGovernor::setEnabled(bool enabled)
+{
+    m_enabled = enabled;
+    if (!enabled) {
+        reset();
+    }
+}
+
+void QualityGovernor::reset()
+{
+    m_level = Full;
+    m_nsPerUnit = 0.0;
+    m_overBudgetFrames = 0;
+    m_headroomFrames = 0;
+}
+
+void QualityGovernor::setWorkload(const CrosshairRenderer::Settings& settings, const QRect& screenGeometry,
+                                  int baseThickness, bool taperSegments)
+{
+    for (int i = 0; i < LevelCount; ++i) {
+        const Level level = static_cast<Level>(i);
+        m_units[i] = qMax(1.0, RenderCost::estimate(degrade(settings, level), screenGeometry, baseThickness,
+                                                    taperSegments).units());
+    }
+
+    m_lowestLevel = taperSegments ? CoarseTaper : FewerShapes;
+    if (m_level > m_lowestLevel) {
+        setLevel(m_lowestLevel);
+    }
+}
+
+bool QualityGovernor::addFrame(qint64 frameTime, qint64 budget)
+{
+    if (!m_enabled || frameTime <= 0 || budget <= 0) return false;
+
+    // Calibrate the model against what this machine and backend actually take
+    const double nsPerUnit = frameTime / m_units[m_level];
+    m_nsPerUnit = m_nsPerUnit > 0.0 ? m_nsPerUnit + (nsPerUnit - m_nsPerUnit) * Smoothing : nsPerUnit;
+
+    const double allowed = budget * BudgetShare;
+    if (frameTime > allowed) {
+        m_headroomFrames = 0;
+        if (++m_overBudgetFrames < OverBudgetFrames || m_level == m_lowestLevel) return false;
+
+        // Straight to the first level predicted to fit, at least one step
+        int next = m_level + 1;
+        while (next < m_lowestLevel && predictedTime(static_cast<Level>(next)) > allowed) {
+            ++next;
+        }
+        setLevel(static_cast<Level>(next));
+        return true;
+    }
+
+    m_overBudgetFrames = 0;
+    if (m_level == Full) return false;
+
+    const Level better = static_cast<Level>(m_level - 1);
+    if (predictedTime(better) > budget * HeadroomShare) {
+        m_headroomFrames = 0;
+        return false;
+    }
+    if (++m_headroomFrames < HeadroomFrames) return false;
+
+    setLevel(better);
+    return true;
+}
+
+void QualityGovernor::setLevel(Level level)
+{
+    m_level = level;
+    m_overBudgetFrames = 0;
+    m_headroomFrames = 0;
+}
+
+const char* QualityGovernor::levelName(Level level)
+{
+    switch (level) {
+    case Full: return "full";
+    case NoAntialiasing: return "no antialiasing";
+    case FewerShapes: return "fewer shapes";
+    case CoarseTaper: return "coarse taper";
+    default: return "unknown";
+    }
+}
+
+CrosshairRenderer::Settings QualityGovernor::apply(const CrosshairRenderer::Settings& settings) const
+{
+    return degrade(settings, m_level);
+}
+
+CrosshairRenderer::Settings QualityGovernor::degrade(CrosshairRenderer::Settings settings, Level level)
+{
+    // Each level keeps the reductions of the levels above it
+    if (level >= NoAntialiasing) {
+        settings.antialiasing = false;
+    }
+    if (level >= FewerShapes) {
+        settings.shapeStride = qMax(2, settings.shapeStride);
+    }
+    if (level >= CoarseTaper) {
+        settings.taperSegments = qMin(settings.taperSegments, CoarseTaperSegments);
+    }
+    return settings;
+}
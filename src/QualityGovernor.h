@@ -0,0 +1,82 @@
+/*
+ * MouseCross - A crosshair overlay application for visually impaired users
+ * Copyright (C) 2025 Stefan Lohmaier <stefan@slohmaier.de>
+ *
+ * This file is part of MouseCross.
+ *
+ * MouseCross is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MouseCross is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with MouseCross. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Project website: https://slohmaier.de/mousecross
+ */
+
+#ifndef QUALITYGOVERNOR_H
+#define QUALITYGOVERNOR_H
+
+#include "CrosshairRenderer.h"
+#include <QRect>
+
+// Steps the crosshair quality down when frames overrun the frame budget and
+// back up once there is headroom again. Measured frame times calibrate the
+// render cost model, which then predicts how long each level would take, so
+// the governor can skip levels that would not help and only steps up when
+// the better level is predicted to fit.
+class QualityGovernor
+{
+public:
+    enum Level {
+        Full = 0,           // As configured
+        NoAntialiasing,     // Aliased shape and taper edges
+        FewerShapes,        // Every other direction shape
+        CoarseTaper,        // Fewer taper steps per arm
+        LevelCount
+    };
+
+    QualityGovernor();
+
+    void setEnabled(bool enabled);
+    bool isEnabled() const { return m_enabled; }
+
+    // Back to full quality, measurements are forgotten
+    void reset();
+
+    // Settings as configured, the desktop they are drawn on and whether the backend
+    // strokes taper steps. Without them CoarseTaper saves nothing and is skipped.
+    void setWorkload(const CrosshairRenderer::Settings& settings, const QRect& screenGeometry, int baseThickness,
+                     bool taperSegments);
+
+    // Adds the render time of a frame drawn at the current level, both in ns.
+    // Returns true when the level changed.
+    bool addFrame(qint64 frameTime, qint64 budget);
+
+    Level level() const { return m_level; }
+    static const char* levelName(Level level);
+
+    // Settings degraded to the current level
+    CrosshairRenderer::Settings apply(const CrosshairRenderer::Settings& settings) const;
+
+private:
+    static CrosshairRenderer::Settings degrade(CrosshairRenderer::Settings settings, Level level);
+    double predictedTime(Level level) const { return m_units[level] * m_nsPerUnit; }
+    void setLevel(Level level);
+
+    bool m_enabled;
+    Level m_level;
+    Level m_lowestLevel;    // Last level that saves work on the current backend
+    double m_units[LevelCount];
+    double m_nsPerUnit;
+    int m_overBudgetFrames;
+    int m_headroomFrames;
+};
+
+#endif // QUALITYGOVERNOR_H
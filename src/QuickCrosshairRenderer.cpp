@@ -0,0 +1,381 @@
+/*
+ * MouseCross - A crosshair overlay application for visually impaired users
+ * Copyright (C) 2025 Stefan Lohmaier <stefan@slohmaier.de>
+ *
+ * This file is part of MouseCross.
+ *
+ * MouseCross is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MouseCross is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with MouseCross. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Project website: https://slohmaier.de/mousecross
+ */
+
+#include "QuickCrosshairRenderer.h"
+#include "CrosshairGeometry.h"
+#include <QApplication>
+#include <QScreen>
+#include <QCursor>
+#include <QHash>
+#include <QImage>
+#include <QPainter>
+#include <QQuickWindow>
+#include <QQuickItem>
+#include <QSGImageNode>
+#include <QSGRectangleNode>
+#include <QSGTexture>
+#include <QSurfaceFormat>
+#include <QtMath>
+
+namespace {
+
+// Length the arm body texture is painted at before it is stretched to the arm
+const int BodyTextureLength = 256;
+
+bool isHorizontal(CrosshairGeometry::Arm arm)
+{
+    return arm == CrosshairGeometry::LeftArm || arm == CrosshairGeometry::RightArm;
+}
+
+// From the arm geometry this flips once the cursor is closer to the screen edge
+// than the offset, textures have to keep their orientation
+QPointF towardsCenter(CrosshairGeometry::Arm arm)
+{
+    switch (arm) {
+        case CrosshairGeometry::LeftArm: return QPointF(1, 0);
+        case CrosshairGeometry::RightArm: return QPointF(-1, 0);
+        case CrosshairGeometry::TopArm: return QPointF(0, 1);
+        default: return QPointF(0, -1);
+    }
+}
+
+int bodyWidth(const CrosshairGeometry::ArmGeometry& arm)
+{
+    return qCeil(qMax(arm.startThickness, arm.endThickness)) + 2;
+}
+
+int shapeExtent(int radius)
+{
+    // Arrows and rautes reach up to 1.3 radii from their center
+    return qCeil(radius * 1.3) + 1;
+}
+
+// Arm body painted at BodyTextureLength, start and end at the same texture edges
+// as in bodyRect()
+QImage paintBody(CrosshairGeometry::Arm armId, const CrosshairGeometry::ArmGeometry& arm,
+                 const CrosshairRenderer::Settings& settings)
+{
+    const bool horizontal = isHorizontal(armId);
+    const int width = bodyWidth(arm);
+    QImage image(horizontal ? QSize(BodyTextureLength, width) : QSize(width, BodyTextureLength),
+                 QImage::Format_ARGB32_Premultiplied);
+    image.fill(Qt::transparent);
+
+    CrosshairGeometry::ArmGeometry local = arm;
+    const QPointF direction = towardsCenter(armId);
+    const double middle = width / 2.0;
+    const double startAt = (direction.x() + direction.y()) > 0 ? BodyTextureLength : 0;
+    const double endAt = BodyTextureLength - startAt;
+    local.start = horizontal ? QPointF(startAt, middle) : QPointF(middle, startAt);
+    local.end = horizontal ? QPointF(endAt, middle) : QPointF(middle, endAt);
+
+    QPainter painter(&image);
+    painter.setRenderHint(QPainter::Antialiasing, settings.antialiasing);
+    CrosshairGeometry::paintArmBody(painter, local, settings);
+    return image;
+}
+
+QRectF bodyRect(CrosshairGeometry::Arm armId, const CrosshairGeometry::ArmGeometry& arm)
+{
+    // A flipped arm lies outside the screen, its orientation does not matter
+    const double half = bodyWidth(arm) / 2.0;
+    const QRectF span = QRectF(arm.start, arm.end).normalized();
+    if (isHorizontal(armId)) {
+        return QRectF(span.left(), arm.start.y() - half, span.width(), half * 2);
+    }
+    return QRectF(arm.start.x() - half, span.top(), half * 2, span.height());
+}
+
+// Half of the closing line lies under the arm start, only the half towards the
+// cursor needs its own node
+QRectF closingRect(CrosshairGeometry::Arm armId, const CrosshairGeometry::ArmGeometry& arm)
+{
+    QRectF rect = arm.closingLine();
+    const QPointF direction = towardsCenter(armId);
+    if (direction.x() > 0) rect.setLeft(arm.start.x());
+    else if (direction.x() < 0) rect.setRight(arm.start.x());
+    else if (direction.y() > 0) rect.setTop(arm.start.y());
+    else rect.setBottom(arm.start.y());
+    return rect;
+}
+
+QImage paintShape(int radius, const QPointF& direction, const CrosshairRenderer::Settings& settings)
+{
+    const int extent = shapeExtent(radius);
+    QImage image(extent * 2, extent * 2, QImage::Format_ARGB32_Premultiplied);
+    image.fill(Qt::transparent);
+
+    QPainter painter(&image);
+    painter.setRenderHint(QPainter::Antialiasing, settings.antialiasing);
+    painter.setPen(Qt::NoPen);
+    painter.setBrush(settings.color);
+    painter.drawPath(CrosshairGeometry::shapePath(settings.directionShape, QPointF(extent, extent),
+                                                  radius, direction));
+    return image;
+}
+
+// Scene graph side of one arm. Lives on the render thread and owns the textures,
+// which are only created again when the settings change or a new shape size
+// shows up.
+class ArmNode : public QSGNode
+{
+public:
+    ~ArmNode() override
+    {
+        delete bodyTexture;
+        qDeleteAll(shapeTextures);
+    }
+
+    int settingsSerial = -1;
+    double startThickness = 0;   // Body texture thickness, changes with the screen scale
+    double endThickness = 0;
+    QSGRectangleNode* closing = nullptr;
+    QSGImageNode* body = nullptr;
+    QSGTexture* bodyTexture = nullptr;
+    QVector<QSGImageNode*> shapes;
+    QHash<int, QSGTexture*> shapeTextures;   // By radius
+};
+
+}
+
+// One crosshair arm including its closing line and shapes. The arm body and the
+// shapes are textured image nodes, both adaptations (GPU and software) render
+// them. A cursor move only changes node rectangles, the body texture is
+// stretched to the arm length, so nothing is repainted until the settings change.
+class CrosshairArmItem : public QQuickItem
+{
+public:
+    CrosshairArmItem(CrosshairGeometry::Arm arm, QQuickItem *parent)
+        : QQuickItem(parent)
+        , m_arm(arm)
+        , m_settingsSerial(0)
+    {
+        setFlag(ItemHasContents, true);
+    }
+
+    void setGeometry(const CrosshairGeometry& geometry, const CrosshairRenderer::Settings& settings, bool settingsChanged)
+    {
+        if (settingsChanged) {
+            m_settings = settings;
+            ++m_settingsSerial;
+        }
+
+        m_armGeometry = geometry.arm(m_arm);
+        m_shapes.clear();
+        for (const CrosshairGeometry::ShapeInstance& shape : geometry.shapes()) {
+            if (shape.arm == m_arm) m_shapes.append(shape);
+        }
+        update();
+    }
+
+protected:
+    QSGNode* updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *) override
+    {
+        ArmNode* node = static_cast<ArmNode*>(oldNode);
+        if (!node) {
+            node = new ArmNode;
+            node->closing = window()->createRectangleNode();
+            node->body = window()->createImageNode();
+            node->body->setFiltering(QSGTexture::Linear);
+            node->appendChildNode(node->closing);
+            node->appendChildNode(node->body);
+        }
+
+        const bool settingsChanged = node->settingsSerial != m_settingsSerial;
+        if (settingsChanged || node->startThickness != m_armGeometry.startThickness
+            || node->endThickness != m_armGeometry.endThickness) {
+            node->settingsSerial = m_settingsSerial;
+            node->startThickness = m_armGeometry.startThickness;
+            node->endThickness = m_armGeometry.endThickness;
+            node->closing->setColor(m_settings.color);
+
+            QSGTexture* bodyTexture = window()->createTextureFromImage(paintBody(m_arm, m_armGeometry, m_settings));
+            node->body->setTexture(bodyTexture);
+            node->body->setSourceRect(QRectF(QPointF(0, 0), bodyTexture->textureSize()));
+            delete node->bodyTexture;
+            node->bodyTexture = bodyTexture;
+        }
+
+        if (settingsChanged) {
+            // Shape nodes pick up the new textures below
+            for (QSGImageNode* shape : node->shapes) {
+                node->removeChildNode(shape);
+                delete shape;
+            }
+            node->shapes.clear();
+            qDeleteAll(node->shapeTextures);
+            node->shapeTextures.clear();
+        }
+
+        node->closing->setRect(closingRect(m_arm, m_armGeometry));
+        node->body->setRect(bodyRect(m_arm, m_armGeometry));
+
+        while (node->shapes.size() > m_shapes.size()) {
+            QSGImageNode* shape = node->shapes.takeLast();
+            node->removeChildNode(shape);
+            delete shape;
+        }
+        for (int i = 0; i < m_shapes.size(); ++i) {
+            const CrosshairGeometry::ShapeInstance& instance = m_shapes[i];
+            QSGTexture*& texture = node->shapeTextures[instance.radius];
+            if (!texture) {
+                texture = window()->createTextureFromImage(
+                    paintShape(instance.radius, towardsCenter(m_arm), m_settings));
+            }
+
+            if (i == node->shapes.size()) {
+                QSGImageNode* shape = window()->createImageNode();
+                node->appendChildNode(shape);
+                node->shapes.append(shape);
+            }
+            QSGImageNode* shape = node->shapes[i];
+            if (shape->texture() != texture) {
+                shape->setTexture(texture);
+                shape->setSourceRect(QRectF(QPointF(0, 0), texture->textureSize()));
+            }
+            const int extent = shapeExtent(instance.radius);
+            shape->setRect(QRectF(instance.center.x() - extent, instance.center.y() - extent, extent * 2, extent * 2));
+        }
+
+        return node;
+    }
+
+private:
+    CrosshairGeometry::Arm m_arm;
+    int m_settingsSerial;
+    CrosshairRenderer::Settings m_settings;
+    CrosshairGeometry::ArmGeometry m_armGeometry {};
+    QVector<CrosshairGeometry::ShapeInstance> m_shapes;
+};
+
+QuickCrosshairRenderer::QuickCrosshairRenderer()
+    : m_arms{}
+{
+}
+
+QuickCrosshairRenderer::~QuickCrosshairRenderer()
+{
+    cleanup();
+}
+
+bool QuickCrosshairRenderer::initialize()
+{
+    m_window = std::make_unique<QQuickWindow>();
+    m_window->setFlags(Qt::WindowStaysOnTopHint |
+                       Qt::FramelessWindowHint |
+                       Qt::Tool |
+                       Qt::WindowTransparentForInput);
+    m_window->setColor(Qt::transparent);
+
+    // GPU adaptations need an alpha channel, the software one blends via the backing store
+    QSurfaceFormat format = m_window->format();
+    format.setAlphaBufferSize(8);
+    m_window->setFormat(format);
+
+    // Cover all screens
+    m_screenGeometry = QRect();
+    for (QScreen *screen : QApplication::screens()) {
+        m_screenGeometry = m_screenGeometry.united(screen->geometry());
+    }
+    m_window->setGeometry(m_screenGeometry);
+
+    for (int i = 0; i < CrosshairGeometry::ArmCount; ++i) {
+        m_arms[i] = new CrosshairArmItem(static_cast<CrosshairGeometry::Arm>(i), m_window->contentItem());
+    }
+
+    // Emitted on the render thread, queued over to this object
+    connect(m_window.get(), &QQuickWindow::frameSwapped, this, [this]() {
+        notifyFramePresented();
+    });
+
+    return true;
+}
+
+void QuickCrosshairRenderer::cleanup()
+{
+    stopRendering();
+
+    // Items are owned by the window's content item
+    m_window.reset();
+    for (CrosshairArmItem*& arm : m_arms) {
+        arm = nullptr;
+    }
+}
+
+void QuickCrosshairRenderer::startRendering()
+{
+    if (m_isRendering || !m_window) return;
+
+    m_window->show();
+    m_window->raise();
+
+    m_isRendering = true;
+    updateMousePosition(QCursor::pos());
+}
+
+void QuickCrosshairRenderer::stopRendering()
+{
+    if (!m_isRendering) return;
+
+    if (m_window) {
+        m_window->hide();
+    }
+    m_isRendering = false;
+}
+
+void QuickCrosshairRenderer::updateSettings(const Settings& settings)
+{
+    m_settings = settings;
+    if (m_window) {
+        // Once for the whole window like the Qt backend, so shapes do not let the
+        // contrast line below them shine through
+        m_window->setOpacity(settings.opacity);
+        updateItems(true);
+    }
+}
+
+void QuickCrosshairRenderer::updateMousePosition(const QPoint& pos)
+{
+    m_mousePos = pos;
+    updateItems(false);
+}
+
+void QuickCrosshairRenderer::updateItems(bool settingsChanged)
+{
+    if (!m_window) return;
+
+    const QRect localScreen(QPoint(0, 0), m_screenGeometry.size());
+    CrosshairGeometry geometry(m_settings, m_mousePos - m_screenGeometry.topLeft(), localScreen, getScaledLineWidth());
+    for (CrosshairArmItem* arm : m_arms) {
+        arm->setGeometry(geometry, m_settings, settingsChanged);
+    }
+}
+
+int QuickCrosshairRenderer::getScaledLineWidth() const
+{
+    QScreen *screen = QApplication::screenAt(m_mousePos);
+    if (!screen) {
+        screen = QApplication::primaryScreen();
+    }
+    int scaledWidth = static_cast<int>(m_settings.lineWidth * screen->devicePixelRatio());
+    return qMax(3, scaledWidth);
+}
@@ -0,0 +1,65 @@
+/*
+ * MouseCross - A crosshair overlay application for visually impaired users
+ * Copyright (C) 2025 Stefan Lohmaier <stefan@slohmaier.de>
+ *
+ * This file is part of MouseCross.
+ *
+ * MouseCross is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MouseCross is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with MouseCross. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Project website: https://slohmaier.de/mousecross
+ */
+
+#ifndef QUICKCROSSHAIRRENDERER_H
+#define QUICKCROSSHAIRRENDERER_H
+
+#include "CrosshairRenderer.h"
+#include <QObject>
+#include <memory>
+
+class QQuickWindow;
+class CrosshairArmItem;
+
+// Retained-mode renderer on top of the Qt Quick scene graph. Each arm is a
+// small tree of image and rectangle nodes whose textures are only painted when
+// the settings change; cursor moves just update node rectangles. Custom geometry
+// nodes would not render on the software adaptation (QT_QUICK_BACKEND=software),
+// which repaints only the areas covered by changed nodes.
+class QuickCrosshairRenderer : public QObject, public CrosshairRenderer
+{
+    Q_OBJECT
+
+public:
+    QuickCrosshairRenderer();
+    ~QuickCrosshairRenderer() override;
+
+    bool initialize() override;
+    void cleanup() override;
+
+    void startRendering() override;
+    void stopRendering() override;
+
+    void updateSettings(const Settings& settings) override;
+    void updateMousePosition(const QPoint& pos) override;
+
+    bool isRendering() const override { return m_isRendering; }
+
+private:
+    void updateItems(bool settingsChanged);
+    int getScaledLineWidth() const;
+
+    std::unique_ptr<QQuickWindow> m_window;
+    CrosshairArmItem* m_arms[4];
+};
+
+#endif // QUICKCROSSHAIRRENDERER_H
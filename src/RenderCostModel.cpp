@@ -0,0 +1,68 @@
+/*
+ * MouseCross - A crosshair overlay application for visually impaired users
+ * Copyright (C) 2025 Stefan Lohmaier <stefan@slohmaier.de>
+ *
+ * This file is part of MouseCross.
+ *
+ * MouseCross is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MouseCross is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with MouseCross. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Project website: https://slohmaier.de/mousecross
+ */
+
+#include "RenderCostModel.h"
+#include "CrosshairGeometry.h"
+
+namespace {
+
+// Setup cost of one primitive (pen change, path, clip test) in filled pixels,
+// roughly what QPainter's raster engine shows for short strokes
+const double PrimitiveUnits = 400.0;
+
+// Coverage computation on shape and taper edges
+const double AntialiasingFactor = 1.5;
+
+}
+
+double RenderCost::units() const
+{
+    const double primitiveUnits = primitives * PrimitiveUnits;
+    return (pixels + primitiveUnits) * (antialiased ? AntialiasingFactor : 1.0);
+}
+
+RenderCost RenderCost::estimate(const CrosshairRenderer::Settings& settings, const QRect& screenGeometry,
+                                int baseThickness, bool taperSegments)
+{
+    RenderCost cost;
+    cost.antialiased = settings.antialiasing;
+    if (screenGeometry.isEmpty()) return cost;
+
+    CrosshairGeometry geometry(settings, screenGeometry.center(), screenGeometry, baseThickness);
+    const bool contrastLine = !settings.inverted && !settings.solidArms;
+    const int segments = settings.solidArms || !taperSegments ? 1 : qMax(1, settings.taperSegments);
+
+    for (int i = 0; i < CrosshairGeometry::ArmCount; ++i) {
+        const CrosshairGeometry::ArmGeometry& arm = geometry.arm(static_cast<CrosshairGeometry::Arm>(i));
+        const double length = qMax(0, arm.totalDistance - settings.offsetFromCursor);
+        const double area = length * (arm.startThickness + arm.endThickness) / 2.0;
+        cost.pixels += qRound64(area * (contrastLine ? 1.5 : 1.0) + length);
+        cost.primitives += segments * (contrastLine ? 2 : 1) + 2;
+    }
+
+    for (const CrosshairGeometry::ShapeInstance& shape : geometry.shapes()) {
+        // Every shape covers roughly the circle of its radius
+        cost.pixels += qRound64(3.14159 * shape.radius * shape.radius);
+        ++cost.primitives;
+    }
+    return cost;
+}
@@ -0,0 +1,47 @@
+/*
+ * MouseCross - A crosshair overlay application for visually impaired users
+ * Copyright (C) 2025 Stefan Lohmaier <stefan@slohmaier.de>
+ *
+ * This file is part of MouseCross.
+ *
+ * MouseCross is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MouseCross is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with MouseCross. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Project website: https://slohmaier.de/mousecross
+ */
+
+#ifndef RENDERCOSTMODEL_H
+#define RENDERCOSTMODEL_H
+
+#include "CrosshairRenderer.h"
+#include <QRect>
+
+// Predicts the work of one crosshair frame from the settings and the desktop
+// size: pixels filled, counting overdraw of the contrast line, and primitives
+// issued. The crosshair is assumed at the desktop center, which is close to
+// the average over all positions. Taper steps only count for backends that
+// stroke them, see CrosshairRenderer::drawsTaperSegments().
+struct RenderCost
+{
+    qint64 pixels = 0;
+    int primitives = 0;
+    bool antialiased = false;
+
+    // Single figure for comparing costs, in filled pixel equivalents
+    double units() const;
+
+    static RenderCost estimate(const CrosshairRenderer::Settings& settings, const QRect& screenGeometry,
+                               int baseThickness, bool taperSegments);
+};
+
+#endif // RENDERCOSTMODEL_H
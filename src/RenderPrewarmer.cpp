@@ -0,0 +1,221 @@
+/*
+ * MouseCross - A crosshair overlay application for visually impaired users
+ * Copyright (C) 2025 Stefan Lohmaier <stefan@slohmaier.de>
+ *
+ * This file is part of MouseCross.
+ *
+ * MouseCross is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MouseCross is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with MouseCross. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Project website: https://slohmaier.de/mousecross
+ */
+
+#include "RenderPrewarmer.h"
+#include "CrosshairGeometry.h"
+#include <QGuiApplication>
+#include <QPainter>
+#include <QScreen>
+#include <QTransform>
+#include <QtMath>
+
+namespace {
+
+// Direction from each arm back to the cursor, in CrosshairGeometry::Arm order
+const QPointF TowardsCenter[CrosshairGeometry::ArmCount] = {
+    QPointF(1, 0), QPointF(-1, 0), QPointF(0, 1), QPointF(0, -1)
+};
+
+}
+
+const PrewarmedState::Screen* PrewarmedState::screenAt(const QPoint& pos) const
+{
+    for (const Screen& screen : screens) {
+        if (screen.geometry.contains(pos)) {
+            return &screen;
+        }
+    }
+    return screens.isEmpty() ? nullptr : &screens.first();
+}
+
+int PrewarmedState::baseThicknessAt(const QPoint& pos) const
+{
+    const Screen* screen = screenAt(pos);
+    return screen ? screen->baseThickness : baseThickness(settings.lineWidth, 1.0);
+}
+
+const PrewarmedState::ShapeMask* PrewarmedState::shapeMask(qreal scale, CrosshairRenderer::DirectionShape shape,
+                                                           int radius, int arm) const
+{
+    auto it = shapeMasks.constFind(shapeKey(scale, shape, radius, arm));
+    return it != shapeMasks.constEnd() ? &it.value() : nullptr;
+}
+
+const PrewarmedState::ShapeImage* PrewarmedState::shapeImage(qreal scale, CrosshairRenderer::DirectionShape shape,
+                                                             int radius, int arm) const
+{
+    auto it = shapeImages.constFind(shapeKey(scale, shape, radius, arm));
+    return it != shapeImages.constEnd() ? &it.value() : nullptr;
+}
+
+QVector<int> PrewarmedState::shapeRadii() const
+{
+    // Shapes grow from a quarter of the base thickness at the cursor to a quarter of the
+    // full taper at the screen edge, every radius in between can show up on some screen
+    QVector<int> radii;
+    if (!settings.showArrows) return radii;
+    for (const Screen& screen : screens) {
+        const int smallest = qMax(1, screen.baseThickness / 4);
+        const int largest = static_cast<int>(screen.baseThickness * qMax(1.0, settings.thicknessMultiplier)) / 4;
+        for (int radius = smallest; radius <= largest; ++radius) {
+            if (!radii.contains(radius)) {
+                radii.append(radius);
+            }
+        }
+    }
+    return radii;
+}
+
+QPointF PrewarmedState::towardsCenter(int arm)
+{
+    return TowardsCenter[arm];
+}
+
+int PrewarmedState::baseThickness(int lineWidth, qreal devicePixelRatio)
+{
+    return qMax(3, static_cast<int>(lineWidth * devicePixelRatio));
+}
+
+quint64 PrewarmedState::shapeKey(qreal scale, CrosshairRenderer::DirectionShape shape, int radius, int arm)
+{
+    return (quint64(qRound(scale * 100)) << 48) | (quint64(shape) << 40) | (quint64(arm) << 32) | quint32(radius);
+}
+
+PrewarmedState::ShapeMask PrewarmedState::rasterizeShape(CrosshairRenderer::DirectionShape shape, int radius,
+                                                         const QPointF& towardsCenter, qreal scale,
+                                                         bool antialiasing)
+{
+    ShapeMask mask;
+    QPainterPath path = QTransform::fromScale(scale, scale)
+                            .map(CrosshairGeometry::shapePath(shape, QPointF(0, 0), radius, towardsCenter));
+    QRect bounds = path.boundingRect().toAlignedRect().adjusted(-1, -1, 1, 1);
+    if (bounds.isEmpty()) return mask;
+
+    mask.alpha = QImage(bounds.size(), QImage::Format_Alpha8);
+    mask.alpha.fill(0);
+    {
+        QPainter painter(&mask.alpha);
+        painter.setRenderHint(QPainter::Antialiasing, antialiasing);
+        painter.translate(-bounds.topLeft());
+        painter.fillPath(path, Qt::black);
+    }
+    mask.origin = bounds.topLeft();
+    return mask;
+}
+
+std::shared_ptr<const PrewarmedState> PrewarmedState::build(const CrosshairRenderer::Settings& settings,
+                                                            const QVector<Screen>& screens)
+{
+    auto state = std::make_shared<PrewarmedState>();
+    state->settings = settings;
+    state->screens = screens;
+    for (Screen& screen : state->screens) {
+        screen.baseThickness = baseThickness(settings.lineWidth, screen.devicePixelRatio);
+        if (settings.solidArms) continue;
+
+        // Same widths as WindowsCrosshairRenderer::drawGradientLine()
+        int r, g, b;
+        settings.color.getRgb(&r, &g, &b);
+        const QColor contrast(255 - r, 255 - g, 255 - b);
+        const int segments = qMax(1, settings.taperSegments);
+        for (int i = 0; i < segments; ++i) {
+            const double progress = static_cast<double>(i) / segments;
+            const double thicknessMultiplier = 1.0 + (settings.thicknessMultiplier - 1.0) * progress;
+            const int thickness = static_cast<int>(screen.baseThickness * thicknessMultiplier);
+            QPen pen(settings.color, thickness, Qt::SolidLine, Qt::FlatCap);
+            screen.taperPens.append(pen);
+            pen.setColor(contrast);
+            pen.setWidth(thickness / 2);
+            screen.contrastPens.append(pen);
+        }
+    }
+
+    QVector<qreal> scales;
+    for (const Screen& screen : std::as_const(state->screens)) {
+        if (!scales.contains(screen.devicePixelRatio)) {
+            scales.append(screen.devicePixelRatio);
+        }
+    }
+    for (int radius : state->shapeRadii()) {
+        for (qreal scale : std::as_const(scales)) {
+            for (int arm = 0; arm < CrosshairGeometry::ArmCount; ++arm) {
+                const quint64 key = shapeKey(scale, settings.directionShape, radius, arm);
+                const ShapeMask mask = rasterizeShape(settings.directionShape, radius, TowardsCenter[arm], scale);
+                state->shapeMasks.insert(key, mask);
+
+                // Coloured copy the QPainter backend blits instead of filling the outline
+                const ShapeMask coverage = settings.antialiasing
+                    ? mask : rasterizeShape(settings.directionShape, radius, TowardsCenter[arm], scale, false);
+                if (coverage.alpha.isNull()) continue;
+                ShapeImage image;
+                image.image = QImage(coverage.alpha.size(), QImage::Format_ARGB32_Premultiplied);
+                image.image.fill(settings.color);
+                {
+                    QPainter painter(&image.image);
+                    painter.setCompositionMode(QPainter::CompositionMode_DestinationIn);
+                    painter.drawImage(0, 0, coverage.alpha);
+                }
+                image.image.setDevicePixelRatio(scale);
+                image.origin = QPointF(coverage.origin) / scale;
+                state->shapeImages.insert(key, image);
+            }
+        }
+    }
+    return state;
+}
+
+RenderPrewarmer::RenderPrewarmer(QObject *parent)
+    : QObject(parent)
+    , m_generation(0)
+{
+    m_pool.setMaxThreadCount(1);
+}
+
+RenderPrewarmer::~RenderPrewarmer()
+{
+    // Results are posted to this object, it has to outlive the build
+    m_pool.clear();
+    m_pool.waitForDone();
+}
+
+void RenderPrewarmer::request(const CrosshairRenderer::Settings& settings)
+{
+    // QScreen is only safe to query on the GUI thread, hand plain values to the worker
+    QVector<PrewarmedState::Screen> screens;
+    for (QScreen* screen : QGuiApplication::screens()) {
+        PrewarmedState::Screen entry;
+        entry.geometry = screen->geometry();
+        entry.devicePixelRatio = screen->devicePixelRatio();
+        screens.append(entry);
+    }
+
+    const quint64 generation = ++m_generation;
+    m_pool.clear();
+    m_pool.start([this, settings, screens, generation]() {
+        std::shared_ptr<const PrewarmedState> state = PrewarmedState::build(settings, screens);
+        QMetaObject::invokeMethod(this, [this, state, generation]() {
+            if (generation == m_generation) {
+                emit ready(state);
+            }
+        }, Qt::QueuedConnection);
+    });
+}
@@ -0,0 +1,110 @@
+/*
+ * MouseCross - A crosshair overlay application for visually impaired users
+ * Copyright (C) 2025 Stefan Lohmaier <stefan@slohmaier.de>
+ *
+ * This file is part of MouseCross.
+ *
+ * MouseCross is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MouseCross is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with MouseCross. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Project website: https://slohmaier.de/mousecross
+ */
+
+#ifndef RENDERPREWARMER_H
+#define RENDERPREWARMER_H
+
+#include "CrosshairRenderer.h"
+#include <QObject>
+#include <QHash>
+#include <QImage>
+#include <QPen>
+#include <QThreadPool>
+#include <QVector>
+#include <memory>
+
+// Render state derived from the settings and the screen layout: line widths
+// and taper pens per screen and the direction shapes rasterized for every
+// screen's device pixel ratio. Immutable once built, so it can be shared
+// between threads.
+struct PrewarmedState
+{
+    struct Screen {
+        QRect geometry;
+        qreal devicePixelRatio = 1.0;
+        int baseThickness = 3;
+        // Taper segments from the cursor outwards in settings.color, for the QPainter backend
+        QVector<QPen> taperPens;
+        QVector<QPen> contrastPens;
+    };
+
+    // Alpha8 coverage of one shape, origin is the top left corner relative to the shape center
+    struct ShapeMask {
+        QImage alpha;
+        QPoint origin;
+    };
+
+    // One shape in settings.color with the device pixel ratio set, origin in
+    // logical pixels relative to the shape center
+    struct ShapeImage {
+        QImage image;
+        QPointF origin;
+    };
+
+    CrosshairRenderer::Settings settings;
+    QVector<Screen> screens;
+    QHash<quint64, ShapeMask> shapeMasks;
+    QHash<quint64, ShapeImage> shapeImages;
+
+    // Screen containing pos, the first screen when outside all, null without screens
+    const Screen* screenAt(const QPoint& pos) const;
+    // Base thickness on the screen containing pos, the first screen's when outside all
+    int baseThicknessAt(const QPoint& pos) const;
+    const ShapeMask* shapeMask(qreal scale, CrosshairRenderer::DirectionShape shape, int radius, int arm) const;
+    const ShapeImage* shapeImage(qreal scale, CrosshairRenderer::DirectionShape shape, int radius, int arm) const;
+    // Radii of the direction shapes that can appear with these settings on these screens
+    QVector<int> shapeRadii() const;
+
+    // Unit vector from arm (CrosshairGeometry::Arm) back to the cursor
+    static QPointF towardsCenter(int arm);
+
+    static int baseThickness(int lineWidth, qreal devicePixelRatio);
+    static ShapeMask rasterizeShape(CrosshairRenderer::DirectionShape shape, int radius,
+                                    const QPointF& towardsCenter, qreal scale, bool antialiasing = true);
+    static std::shared_ptr<const PrewarmedState> build(const CrosshairRenderer::Settings& settings,
+                                                       const QVector<Screen>& screens);
+    // Key of shapeMasks, also used by backends that cache uploaded masks
+    static quint64 shapeKey(qreal scale, CrosshairRenderer::DirectionShape shape, int radius, int arm);
+};
+
+// Builds the PrewarmedState for the current settings and screens on a worker
+// thread. A new request supersedes one still in flight, only the latest
+// result is delivered, on the thread the prewarmer lives in.
+class RenderPrewarmer : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit RenderPrewarmer(QObject *parent = nullptr);
+    ~RenderPrewarmer() override;
+
+    void request(const CrosshairRenderer::Settings& settings);
+
+signals:
+    void ready(const std::shared_ptr<const PrewarmedState>& state);
+
+private:
+    QThreadPool m_pool;
+    quint64 m_generation;
+};
+
+#endif // RENDERPREWARMER_H
@@ -0,0 +1,429 @@
+/*
+ * MouseCross - A crosshair overlay application for visually impaired users
+ * Copyright (C) 2025 Stefan Lohmaier <stefan@slohmaier.de>
+ *
+ * This file is part of MouseCross.
+ *
+ * MouseCross is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MouseCross is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with MouseCross. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Project website: https://slohmaier.de/mousecross
+ */
+
+#include "RendererRegistry.h"
+#include "SettingsManager.h"
+#include <QGuiApplication>
+#include <QObject>
+#include <QScreen>
+#include <QElapsedTimer>
+#include <QTimer>
+#include <QStringList>
+#include <QDebug>
+#include <limits>
+
+#ifdef Q_OS_WIN
+#include <windows.h>
+#endif
+
+#ifdef Q_OS_MAC
+#include "MacOSCrosshairRenderer.h"
+#else
+#include "WindowsCrosshairRenderer.h"
+#endif
+#ifdef HAVE_X11
+#include "X11Support.h"
+#include "X11XorCrosshairRenderer.h"
+#endif
+#ifdef HAVE_XRENDER
+#include "XRenderCrosshairRenderer.h"
+#endif
+#ifdef HAVE_QTQUICK
+#include "QuickCrosshairRenderer.h"
+#endif
+#ifdef HAVE_WAYLAND_LAYER_SHELL
+#include "WaylandCrosshairRenderer.h"
+#endif
+
+namespace {
+
+const QString AutoBackend = QStringLiteral("auto");
+
+// Frames rendered before timing starts, fills caches and wakes up the X server
+const int WarmupFrames = 3;
+const int MeasuredFrames = 30;
+// Longest wait for a frame, backends that take longer are not picked
+const int FrameTimeoutMs = 250;
+
+template <typename T>
+std::unique_ptr<CrosshairRenderer> make()
+{
+    return std::make_unique<T>();
+}
+
+bool always(const RendererCapabilities&)
+{
+    return true;
+}
+
+// Cursor path for the benchmark, spreads over the screen so arm lengths keep
+// changing, with every other step repeating a length like a straight drag would
+QPoint benchmarkPosition(const QSize& screenSize, int frame)
+{
+    const int steps = MeasuredFrames;
+    const int step = frame % steps;
+    const int x = screenSize.width() * (2 * step + 1) / (2 * steps);
+    const int y = screenSize.height() * (2 * ((step / 2 * 7) % steps) + 1) / (2 * steps);
+    return QPoint(x, y);
+}
+
+bool isRemoteSession(const RendererCapabilities& caps)
+{
+    // Manual override for detection misses, "1" or "0"
+    const QByteArray forced = qgetenv("MOUSECROSS_REMOTE_SESSION");
+    if (!forced.isEmpty()) return forced != "0";
+
+#ifdef Q_OS_WIN
+    Q_UNUSED(caps);
+    return GetSystemMetrics(SM_REMOTESESSION) != 0;
+#else
+    if (qEnvironmentVariableIsSet("XRDP_SESSION") || qEnvironmentVariableIsSet("XRDP_SOCKET_PATH")
+        || qEnvironmentVariableIsSet("VNCDESKTOP")) {
+        return true;
+    }
+
+    // A DISPLAY with a host part, e.g. "localhost:10.0" from ssh -X, goes over the network
+    const QString display = qEnvironmentVariable("DISPLAY");
+    if (caps.x11 && !display.startsWith(QLatin1Char(':')) && !display.startsWith(QLatin1String("unix:"))
+        && !display.startsWith(QLatin1Char('/'))) {
+        return true;
+    }
+
+    // Output names of Xvnc and xorgxrdp
+    for (QScreen *screen : QGuiApplication::screens()) {
+        const QString name = screen->name();
+        if (name.startsWith(QLatin1String("VNC"), Qt::CaseInsensitive)
+            || name.startsWith(QLatin1String("rdp"), Qt::CaseInsensitive)) {
+            return true;
+        }
+    }
+
+#ifdef HAVE_X11
+    return X11Support::isRemoteServer();
+#else
+    return false;
+#endif
+#endif
+}
+
+}
+
+RendererCapabilities RendererCapabilities::probe()
+{
+    RendererCapabilities caps;
+    caps.platform = QGuiApplication::platformName();
+    if (QScreen *screen = QGuiApplication::primaryScreen()) {
+        caps.screenSize = screen->virtualSize();
+    }
+
+#ifdef HAVE_X11
+    caps.x11 = X11Support::isAvailable();
+    caps.compositor = X11Support::hasCompositingManager();
+    // Qt's xcb backing store uploads through MIT-SHM, without it every frame is a full XPutImage
+    caps.shm = X11Support::hasExtension("MIT-SHM");
+#endif
+#ifdef HAVE_XRENDER
+    caps.xrender = XRenderCrosshairRenderer::isSupported();
+#endif
+    caps.wayland = caps.platform.startsWith(QLatin1String("wayland"));
+#ifdef HAVE_WAYLAND_LAYER_SHELL
+    caps.layerShell = WaylandCrosshairRenderer::isSupported();
+#endif
+#ifdef HAVE_QTQUICK
+    caps.quick = true;
+#endif
+    caps.remote = isRemoteSession(caps);
+#if defined(Q_OS_WIN) || defined(Q_OS_MAC)
+    caps.compositor = true;
+    caps.shm = true;
+#else
+    if (caps.wayland) {
+        // Every Wayland session is composited and shares buffers through wl_shm
+        caps.compositor = true;
+        caps.shm = true;
+    }
+#endif
+    return caps;
+}
+
+QString RendererCapabilities::fingerprint() const
+{
+    QStringList parts;
+    parts << platform
+          << QString::number(x11) << QString::number(compositor) << QString::number(shm)
+          << QString::number(xrender) << QString::number(layerShell) << QString::number(quick)
+          << QString::number(remote)
+          << QString::number(screenSize.width()) + 'x' + QString::number(screenSize.height());
+    return parts.join(';');
+}
+
+const std::vector<RendererRegistry::Backend>& RendererRegistry::backends()
+{
+    static const std::vector<Backend> list = {
+#ifdef Q_OS_MAC
+        { QStringLiteral("native"), QObject::tr("Native overlay"), always, make<MacOSCrosshairRenderer> },
+#else
+        { QStringLiteral("qt"), QObject::tr("Qt overlay window"), always, make<WindowsCrosshairRenderer> },
+#endif
+#ifdef HAVE_WAYLAND_LAYER_SHELL
+        // Follows QCursor::pos(), which Wayland only updates while a Qt surface has
+        // pointer focus. Experimental until it has a pointer source of its own.
+        { QStringLiteral("wayland"), QObject::tr("Wayland layer shell"),
+          [](const RendererCapabilities& caps) { return caps.layerShell; },
+          make<WaylandCrosshairRenderer>, true },
+#endif
+#ifdef HAVE_XRENDER
+        // Draws into a translucent window, needs a compositor to be visible
+        { QStringLiteral("xrender"), QObject::tr("X11 XRender"),
+          [](const RendererCapabilities& caps) { return caps.xrender && caps.compositor; },
+          make<XRenderCrosshairRenderer> },
+#endif
+#ifdef HAVE_X11
+        { QStringLiteral("xor"), QObject::tr("X11 XOR (no compositor)"),
+          [](const RendererCapabilities& caps) { return caps.x11; },
+          make<X11XorCrosshairRenderer> },
+#endif
+#ifdef HAVE_QTQUICK
+        { QStringLiteral("quick"), QObject::tr("Qt Quick scene graph"),
+          [](const RendererCapabilities& caps) { return caps.quick; },
+          make<QuickCrosshairRenderer> },
+#endif
+    };
+    return list;
+}
+
+const RendererRegistry::Backend* RendererRegistry::find(const QString& id)
+{
+    for (const Backend& backend : backends()) {
+        if (backend.id == id) return &backend;
+    }
+    return nullptr;
+}
+
+std::vector<const RendererRegistry::Backend*> RendererRegistry::availableBackends(const RendererCapabilities& caps)
+{
+    std::vector<const Backend*> available;
+    for (const Backend& backend : backends()) {
+        if (!backend.experimental && backend.isAvailable(caps)) available.push_back(&backend);
+    }
+    return available;
+}
+
+std::unique_ptr<CrosshairRenderer> RendererRegistry::create(const QString& id)
+{
+    const Backend* backend = find(id);
+    if (!backend) backend = &backends().front();
+    return backend->create();
+}
+
+bool RendererRegistry::isAutoCandidate(const Backend& backend, const RendererCapabilities& caps)
+{
+    if (backend.experimental || !backend.isAvailable(caps)) return false;
+    // XOR drawing on the root window is hidden or smeared by a compositor, only
+    // pick it automatically when nothing composites
+    if (backend.id == QLatin1String("xor")) return !caps.compositor;
+    // Without a compositor a translucent window shows as an opaque black sheet
+    if (caps.x11 && !caps.compositor) return false;
+    return true;
+}
+
+QString RendererRegistry::defaultBackend(const RendererCapabilities& caps)
+{
+    if (find(QStringLiteral("xor")) && caps.x11 && !caps.compositor) return QStringLiteral("xor");
+    // Without MIT-SHM the Qt overlay pays a full-screen upload per frame
+    if (find(QStringLiteral("xrender")) && !caps.shm && caps.xrender && caps.compositor) {
+        return QStringLiteral("xrender");
+    }
+    return backends().front().id;
+}
+
+bool RendererRegistry::needsBenchmark(SettingsManager* settings, const RendererCapabilities& caps)
+{
+    if (!settings || !qEnvironmentVariableIsEmpty("MOUSECROSS_RENDERER")) return false;
+    if (settings->rendererBackend() != AutoBackend) return false;
+    if (settings->rendererFingerprint() == caps.fingerprint()) return false;
+
+    return autoCandidates(caps).size() > 1;
+}
+
+std::vector<const RendererRegistry::Backend*> RendererRegistry::autoCandidates(const RendererCapabilities& caps)
+{
+    std::vector<const Backend*> candidates;
+    for (const Backend& backend : backends()) {
+        if (isAutoCandidate(backend, caps)) candidates.push_back(&backend);
+    }
+    return candidates;
+}
+
+QString RendererRegistry::selectBackend(SettingsManager* settings, const RendererCapabilities& caps)
+{
+    // Environment first so a broken stored choice can always be overridden
+    const QString requested = qEnvironmentVariable("MOUSECROSS_RENDERER");
+    if (!requested.isEmpty()) {
+        const Backend* backend = find(requested);
+        if (backend && backend->isAvailable(caps)) return backend->id;
+        qWarning() << "Renderer" << requested << "is not available in this session";
+    }
+
+    if (!settings) return defaultBackend(caps);
+
+    const QString manual = settings->rendererBackend();
+    if (manual != AutoBackend) {
+        const Backend* backend = find(manual);
+        if (backend && !backend->experimental && backend->isAvailable(caps)) return backend->id;
+        qWarning() << "Renderer" << manual << "is not available in this session, using auto";
+    }
+
+    if (settings->rendererFingerprint() == caps.fingerprint()) {
+        const Backend* backend = find(settings->benchmarkedRenderer());
+        if (backend && backend->isAvailable(caps)) return backend->id;
+    }
+    return defaultBackend(caps);
+}
+
+RendererBenchmark::RendererBenchmark(const RendererCapabilities& caps,
+                                     const CrosshairRenderer::Settings& rendererSettings, QObject *parent)
+    : QObject(parent)
+    , m_caps(caps)
+    , m_settings(rendererSettings)
+    , m_timeout(new QTimer(this))
+    , m_next(0)
+    , m_frame(0)
+    , m_serial(0)
+    , m_waiting(false)
+    , m_running(false)
+    , m_fastestTime(std::numeric_limits<qint64>::max())
+{
+    // Every backend does the same end-to-end work: the real frame path into its mapped
+    // overlay, waiting until the frame was presented and the display server caught up.
+    // Transparent for the overlays and XOR with zero on the root window, so nothing shows.
+    m_settings.opacity = 0.0;
+    m_settings.color = Qt::black;
+    m_settings.inverted = false;
+
+    m_timeout->setSingleShot(true);
+    m_timeout->setInterval(FrameTimeoutMs);
+    connect(m_timeout, &QTimer::timeout, this, [this]() { finishBackend(false); });
+}
+
+RendererBenchmark::~RendererBenchmark()
+{
+    releaseRenderer();
+}
+
+void RendererBenchmark::start()
+{
+    if (m_running) return;
+
+    m_running = true;
+    m_candidates = RendererRegistry::autoCandidates(m_caps);
+    m_next = 0;
+    m_fastest.clear();
+    m_fastestTime = std::numeric_limits<qint64>::max();
+    startNextBackend();
+}
+
+void RendererBenchmark::startNextBackend()
+{
+    while (m_next < m_candidates.size()) {
+        const RendererRegistry::Backend* backend = m_candidates[m_next++];
+        m_renderer = backend->create();
+        if (!m_renderer->initialize()) {
+            releaseRenderer();
+            continue;
+        }
+        m_renderer->updateSettings(m_settings);
+        m_renderer->startRendering();
+        if (!m_renderer->isRendering()) {
+            releaseRenderer();
+            continue;
+        }
+
+        // Most backends present from inside updateMousePosition(), count the frame
+        // from the event loop so the next one is not handed out recursively
+        m_backendId = backend->id;
+        m_renderer->setFramePresentedCallback([this]() {
+            const quint64 serial = m_serial;
+            QMetaObject::invokeMethod(this, [this, serial]() { handleFramePresented(serial); },
+                                      Qt::QueuedConnection);
+        });
+        m_frame = 0;
+        presentNextFrame();
+        return;
+    }
+
+    m_running = false;
+    emit finished(m_fastest);
+}
+
+void RendererBenchmark::presentNextFrame()
+{
+    const int step = m_frame < WarmupFrames ? m_frame : m_frame - WarmupFrames;
+    ++m_serial;
+    m_waiting = true;
+    m_timeout->start();
+    m_renderer->updateMousePosition(benchmarkPosition(m_caps.screenSize, step));
+}
+
+void RendererBenchmark::handleFramePresented(quint64 serial)
+{
+    if (!m_waiting || serial != m_serial) return;
+
+    m_waiting = false;
+    m_timeout->stop();
+    m_renderer->syncDisplay();
+
+    // Timing starts after the warmup frames
+    ++m_frame;
+    if (m_frame == WarmupFrames) {
+        m_timer.start();
+    } else if (m_frame == WarmupFrames + MeasuredFrames) {
+        finishBackend(true);
+        return;
+    }
+    presentNextFrame();
+}
+
+void RendererBenchmark::finishBackend(bool measured)
+{
+    const qint64 elapsed = m_timer.nsecsElapsed();
+    ++m_serial;
+    m_waiting = false;
+    m_timeout->stop();
+    releaseRenderer();
+
+    if (measured && elapsed < m_fastestTime) {
+        m_fastestTime = elapsed;
+        m_fastest = m_backendId;
+    }
+    startNextBackend();
+}
+
+void RendererBenchmark::releaseRenderer()
+{
+    if (!m_renderer) return;
+
+    m_renderer->setFramePresentedCallback(nullptr);
+    m_renderer->stopRendering();
+    m_renderer->cleanup();
+    m_renderer.reset();
+}
@@ -0,0 +1,137 @@
+/*
+ * MouseCross - A crosshair overlay application for visually impaired users
+ * Copyright (C) 2025 Stefan Lohmaier <stefan@slohmaier.de>
+ *
+ * This file is part of MouseCross.
+ *
+ * MouseCross is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MouseCross is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with MouseCross. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Project website: https://slohmaier.de/mousecross
+ */
+
+#ifndef RENDERERREGISTRY_H
+#define RENDERERREGISTRY_H
+
+#include "CrosshairRenderer.h"
+#include <QElapsedTimer>
+#include <QObject>
+#include <QSize>
+#include <QString>
+#include <memory>
+#include <vector>
+
+class SettingsManager;
+class QTimer;
+
+// What the running session offers, probed once per renderer selection
+struct RendererCapabilities {
+    QString platform;
+    bool x11 = false;
+    bool compositor = false;
+    bool shm = false;
+    bool xrender = false;
+    bool wayland = false;
+    bool layerShell = false;
+    bool quick = false;
+    bool remote = false;      // VNC, RDP or a forwarded X display, pixels cost bandwidth
+    QSize screenSize;
+
+    static RendererCapabilities probe();
+
+    // Changes whenever a stored benchmark result may no longer apply
+    QString fingerprint() const;
+};
+
+// Runtime list of the renderer backends compiled into this build. Picks one per
+// session: MOUSECROSS_RENDERER, then the manual override from the settings, then
+// the result of a short benchmark that runs once per fingerprint.
+class RendererRegistry
+{
+public:
+    struct Backend {
+        QString id;
+        QString displayName;
+        bool (*isAvailable)(const RendererCapabilities& caps);
+        std::unique_ptr<CrosshairRenderer> (*create)();
+        // Only reachable through MOUSECROSS_RENDERER, never listed, stored or auto picked
+        bool experimental = false;
+    };
+
+    static const std::vector<Backend>& backends();
+    static const Backend* find(const QString& id);
+    // Backends the user may choose from, experimental ones are left out
+    static std::vector<const Backend*> availableBackends(const RendererCapabilities& caps);
+
+    static std::unique_ptr<CrosshairRenderer> create(const QString& id);
+
+    // Best guess without measuring
+    static QString defaultBackend(const RendererCapabilities& caps);
+
+    // Backend id to use for this session: the stored benchmark result when it was
+    // measured in this session, the default otherwise. Never benchmarks.
+    static QString selectBackend(SettingsManager* settings, const RendererCapabilities& caps);
+
+    // True when auto selection has no result for this session yet
+    static bool needsBenchmark(SettingsManager* settings, const RendererCapabilities& caps);
+
+    // Backends auto selection may pick from, in list order
+    static std::vector<const Backend*> autoCandidates(const RendererCapabilities& caps);
+
+private:
+    static bool isAutoCandidate(const Backend& backend, const RendererCapabilities& caps);
+};
+
+// Renders invisible frames through every auto candidate's real path, presented and
+// synced, and reports the fastest. Driven from the event loop: each frame is handed
+// out once the previous one was presented, a timeout drops backends that stall.
+class RendererBenchmark : public QObject
+{
+    Q_OBJECT
+
+public:
+    RendererBenchmark(const RendererCapabilities& caps, const CrosshairRenderer::Settings& rendererSettings,
+                      QObject *parent = nullptr);
+    ~RendererBenchmark() override;
+
+    void start();
+    bool isRunning() const { return m_running; }
+
+signals:
+    // Empty when no candidate could be measured
+    void finished(const QString& fastest);
+
+private:
+    void startNextBackend();
+    void presentNextFrame();
+    void handleFramePresented(quint64 serial);
+    void finishBackend(bool measured);
+    void releaseRenderer();
+
+    RendererCapabilities m_caps;
+    CrosshairRenderer::Settings m_settings;
+    QTimer* m_timeout;
+    std::vector<const RendererRegistry::Backend*> m_candidates;
+    size_t m_next;
+    std::unique_ptr<CrosshairRenderer> m_renderer;
+    QString m_backendId;
+    int m_frame;
+    quint64 m_serial;   // Frame handed out last, presents of older frames are ignored
+    bool m_waiting;
+    bool m_running;
+    QElapsedTimer m_timer;
+    QString m_fastest;
+    qint64 m_fastestTime;
+};
+
+#endif // RENDERERREGISTRY_H
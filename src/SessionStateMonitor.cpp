@@ -0,0 +1,305 @@
+/*
+ * MouseCross - A crosshair overlay application for visually impaired users
+ * Copyright (C) 2025 Stefan Lohmaier <stefan@slohmaier.de>
+ *
+ * This file is part of MouseCross.
+ *
+ * MouseCross is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MouseCross is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with MouseCross. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Project website: https://slohmaier.de/mousecross
+ */
+
+#include "SessionStateMonitor.h"
+#include "Logging.h"
+#include <QCoreApplication>
+
+#ifdef HAVE_QTDBUS
+#include <QDBusConnection>
+#include <QDBusInterface>
+#include <QDBusObjectPath>
+#include <QDBusReply>
+#endif
+
+#if defined(HAVE_X11) && defined(HAVE_XCB)
+#include "X11Support.h"
+#include <X11/Xlib.h>
+#include <X11/Xatom.h>
+#include <xcb/xcb.h>
+#ifdef HAVE_XFIXES
+#include <X11/extensions/Xfixes.h>
+#endif
+#define SESSIONSTATE_X11
+#endif
+
+namespace {
+
+// Cursor images seen so far, by serial. Cursors are few, but themes may animate.
+const int MaxCachedCursors = 64;
+
+}
+
+SessionStateMonitor::SessionStateMonitor(QObject *parent)
+    : QObject(parent)
+    , m_active(false)
+    , m_reasons(NoReason)
+    , m_activeWindow(0)
+    , m_selectedActiveWindow(false)
+    , m_wmStateAtom(0)
+    , m_fullscreenAtom(0)
+    , m_xfixesEventBase(-1)
+{
+}
+
+SessionStateMonitor::~SessionStateMonitor()
+{
+    stop();
+}
+
+void SessionStateMonitor::start()
+{
+    if (m_active) return;
+    m_active = true;
+
+#ifdef SESSIONSTATE_X11
+    if (Display* dpy = X11Support::display()) {
+        QCoreApplication::instance()->installNativeEventFilter(this);
+
+        m_wmStateAtom = XInternAtom(dpy, "_NET_WM_STATE", False);
+        m_fullscreenAtom = XInternAtom(dpy, "_NET_WM_STATE_FULLSCREEN", False);
+
+#ifdef HAVE_XFIXES
+        int errorBase = 0;
+        if (XFixesQueryExtension(dpy, &m_xfixesEventBase, &errorBase)) {
+            XFixesSelectCursorInput(dpy, X11Support::rootWindow(), XFixesDisplayCursorNotifyMask);
+            updateCursorVisibility();
+        } else {
+            m_xfixesEventBase = -1;
+        }
+#endif
+        XFlush(dpy);
+    }
+#endif
+
+    connectLockSignals(true);
+}
+
+void SessionStateMonitor::stop()
+{
+    if (!m_active) return;
+    m_active = false;
+
+#ifdef SESSIONSTATE_X11
+    if (Display* dpy = X11Support::display()) {
+        QCoreApplication::instance()->removeNativeEventFilter(this);
+        if (m_selectedActiveWindow) {
+            X11Support::selectEvents(m_activeWindow, PropertyChangeMask, false);
+        }
+        m_activeWindow = 0;
+        m_selectedActiveWindow = false;
+#ifdef HAVE_XFIXES
+        if (m_xfixesEventBase >= 0) {
+            XFixesSelectCursorInput(dpy, X11Support::rootWindow(), 0);
+        }
+#endif
+        XFlush(dpy);
+    }
+#endif
+
+    connectLockSignals(false);
+
+    // Nothing is known while not watching, so nothing holds the overlay back
+    const bool wasSuspended = isSuspended();
+    m_reasons = NoReason;
+    if (wasSuspended) {
+        emit suspendedChanged(false);
+    }
+}
+
+void SessionStateMonitor::setReason(Reason reason, bool set)
+{
+    const bool wasSuspended = isSuspended();
+    m_reasons.setFlag(reason, set);
+    if (wasSuspended != isSuspended()) {
+        qCDebug(lcDiagnostics) << "Crosshair" << (isSuspended() ? "suspended" : "resumed") << "reasons:" << int(m_reasons);
+        emit suspendedChanged(isSuspended());
+    }
+}
+
+void SessionStateMonitor::setScreenLocked(bool locked)
+{
+    if (!m_active) return;
+    setReason(ScreenLocked, locked);
+}
+
+void SessionStateMonitor::connectLockSignals(bool enabled)
+{
+#ifdef HAVE_QTDBUS
+    // Screen savers announce the lock on the session bus, logind on the system bus
+    QDBusConnection session = QDBusConnection::sessionBus();
+    QDBusConnection system = QDBusConnection::systemBus();
+
+    if (enabled && m_sessionPath.isEmpty() && system.isConnected()) {
+        QDBusInterface manager(QStringLiteral("org.freedesktop.login1"), QStringLiteral("/org/freedesktop/login1"),
+                               QStringLiteral("org.freedesktop.login1.Manager"), system);
+        QDBusReply<QDBusObjectPath> reply = manager.call(QStringLiteral("GetSessionByPID"),
+                                                         quint32(QCoreApplication::applicationPid()));
+        if (reply.isValid()) {
+            m_sessionPath = reply.value().path();
+        }
+    }
+
+    const struct {
+        QString service;
+        QString path;
+    } screenSavers[] = {
+        { QStringLiteral("org.freedesktop.ScreenSaver"), QStringLiteral("/org/freedesktop/ScreenSaver") },
+        { QStringLiteral("org.gnome.ScreenSaver"), QStringLiteral("/org/gnome/ScreenSaver") },
+    };
+    for (const auto& screenSaver : screenSavers) {
+        if (enabled) {
+            session.connect(screenSaver.service, screenSaver.path, screenSaver.service, QStringLiteral("ActiveChanged"),
+                            this, SLOT(setScreenLocked(bool)));
+        } else {
+            session.disconnect(screenSaver.service, screenSaver.path, screenSaver.service, QStringLiteral("ActiveChanged"),
+                               this, SLOT(setScreenLocked(bool)));
+        }
+    }
+
+    if (!m_sessionPath.isEmpty()) {
+        const QString service = QStringLiteral("org.freedesktop.login1");
+        const QString interface = QStringLiteral("org.freedesktop.login1.Session");
+        if (enabled) {
+            system.connect(service, m_sessionPath, interface, QStringLiteral("Lock"), this, SLOT(onSessionLocked()));
+            system.connect(service, m_sessionPath, interface, QStringLiteral("Unlock"), this, SLOT(onSessionUnlocked()));
+        } else {
+            system.disconnect(service, m_sessionPath, interface, QStringLiteral("Lock"), this, SLOT(onSessionLocked()));
+            system.disconnect(service, m_sessionPath, interface, QStringLiteral("Unlock"), this, SLOT(onSessionUnlocked()));
+        }
+    }
+#else
+    Q_UNUSED(enabled);
+#endif
+}
+
+void SessionStateMonitor::setActiveWindow(unsigned long window)
+{
+    if (!m_active) return;
+
+#ifdef SESSIONSTATE_X11
+    // Follow _NET_WM_STATE of the active window only, a window going fullscreen
+    // in the background does not cover the cursor. Only a mask we added is ours
+    // to remove again, Qt selects property changes on its own windows.
+    if (window != m_activeWindow) {
+        if (m_selectedActiveWindow) {
+            X11Support::selectEvents(m_activeWindow, PropertyChangeMask, false);
+        }
+        m_activeWindow = window;
+        m_selectedActiveWindow = X11Support::selectEvents(m_activeWindow, PropertyChangeMask, true);
+    }
+    updateFullscreen();
+#else
+    Q_UNUSED(window);
+#endif
+}
+
+void SessionStateMonitor::updateFullscreen()
+{
+#ifdef SESSIONSTATE_X11
+    Display* dpy = X11Support::display();
+    bool fullscreen = false;
+    if (dpy && m_activeWindow) {
+        Atom type = None;
+        int format = 0;
+        unsigned long count = 0;
+        unsigned long remaining = 0;
+        unsigned char* data = nullptr;
+        if (XGetWindowProperty(dpy, m_activeWindow, m_wmStateAtom, 0, 64, False, XA_ATOM,
+                               &type, &format, &count, &remaining, &data) == Success && data) {
+            const auto* states = reinterpret_cast<unsigned long*>(data);
+            for (unsigned long i = 0; i < count; ++i) {
+                if (states[i] == m_fullscreenAtom) {
+                    fullscreen = true;
+                    break;
+                }
+            }
+            XFree(data);
+        }
+    }
+    setReason(FullscreenWindow, fullscreen);
+#endif
+}
+
+void SessionStateMonitor::updateCursorVisibility()
+{
+#if defined(SESSIONSTATE_X11) && defined(HAVE_XFIXES)
+    Display* dpy = X11Support::display();
+    if (!dpy) return;
+
+    XFixesCursorImage* image = XFixesGetCursorImage(dpy);
+    if (!image) return;
+
+    // Applications hide the cursor by setting a fully transparent one
+    auto cached = m_hiddenCursors.constFind(image->cursor_serial);
+    bool hidden = false;
+    if (cached != m_hiddenCursors.constEnd()) {
+        hidden = cached.value();
+    } else {
+        hidden = true;
+        const int pixels = image->width * image->height;
+        for (int i = 0; i < pixels; ++i) {
+            if ((image->pixels[i] >> 24) & 0xff) {
+                hidden = false;
+                break;
+            }
+        }
+        if (m_hiddenCursors.size() >= MaxCachedCursors) {
+            m_hiddenCursors.clear();
+        }
+        m_hiddenCursors.insert(image->cursor_serial, hidden);
+    }
+    XFree(image);
+
+    setReason(CursorHidden, hidden);
+#endif
+}
+
+bool SessionStateMonitor::nativeEventFilter(const QByteArray& eventType, void* message, qintptr* result)
+{
+    Q_UNUSED(result);
+
+#ifdef SESSIONSTATE_X11
+    if (eventType != "xcb_generic_event_t") return false;
+
+    auto* event = static_cast<xcb_generic_event_t*>(message);
+    const uint8_t responseType = event->response_type & ~0x80;
+
+    if (responseType == XCB_PROPERTY_NOTIFY) {
+        auto* property = reinterpret_cast<xcb_property_notify_event_t*>(event);
+        if (property->window == m_activeWindow && property->atom == m_wmStateAtom) {
+            updateFullscreen();
+        }
+    }
+#ifdef HAVE_XFIXES
+    else if (m_xfixesEventBase >= 0 && responseType == m_xfixesEventBase + XFixesCursorNotify) {
+        updateCursorVisibility();
+    }
+#endif
+#else
+    Q_UNUSED(eventType);
+    Q_UNUSED(message);
+#endif
+
+    // Qt relies on these events as well
+    return false;
+}
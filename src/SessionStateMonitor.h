@@ -0,0 +1,96 @@
+/*
+ * MouseCross - A crosshair overlay application for visually impaired users
+ * Copyright (C) 2025 Stefan Lohmaier <stefan@slohmaier.de>
+ *
+ * This file is part of MouseCross.
+ *
+ * MouseCross is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MouseCross is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with MouseCross. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Project website: https://slohmaier.de/mousecross
+ */
+
+#ifndef SESSIONSTATEMONITOR_H
+#define SESSIONSTATEMONITOR_H
+
+#include <QObject>
+#include <QAbstractNativeEventFilter>
+#include <QHash>
+
+// Watches for situations in which the crosshair is useless and only costs
+// frames: a fullscreen active window (video, games), an application that
+// hid the cursor, or a locked session. The overlay suspends itself while
+// any of them holds and resumes as soon as all are cleared. The active window
+// is fed in by ActiveWindowTracker, so _NET_ACTIVE_WINDOW is only watched once.
+class SessionStateMonitor : public QObject, public QAbstractNativeEventFilter
+{
+    Q_OBJECT
+
+public:
+    enum Reason {
+        NoReason = 0x0,
+        FullscreenWindow = 0x1,
+        CursorHidden = 0x2,
+        ScreenLocked = 0x4
+    };
+    Q_DECLARE_FLAGS(Reasons, Reason)
+
+    explicit SessionStateMonitor(QObject *parent = nullptr);
+    ~SessionStateMonitor() override;
+
+    // Starts watching and evaluates the cursor and lock state right away, the
+    // fullscreen state once the active window is set
+    void start();
+    void stop();
+    bool isActive() const { return m_active; }
+
+    Reasons reasons() const { return m_reasons; }
+    bool isSuspended() const { return m_reasons != NoReason; }
+
+    bool nativeEventFilter(const QByteArray& eventType, void* message, qintptr* result) override;
+
+signals:
+    void suspendedChanged(bool suspended);
+
+public slots:
+    // Follows _NET_WM_STATE of this window, ignored while not watching
+    void setActiveWindow(unsigned long window);
+
+private slots:
+    void setScreenLocked(bool locked);
+    void onSessionLocked() { setScreenLocked(true); }
+    void onSessionUnlocked() { setScreenLocked(false); }
+
+private:
+    void setReason(Reason reason, bool set);
+    void connectLockSignals(bool enabled);
+    void updateFullscreen();
+    void updateCursorVisibility();
+
+    bool m_active;
+    Reasons m_reasons;
+
+    // X11 state, all zero when not running on X11
+    unsigned long m_activeWindow;
+    bool m_selectedActiveWindow; // PropertyChangeMask on m_activeWindow was added by us
+    unsigned long m_wmStateAtom;
+    unsigned long m_fullscreenAtom;
+    int m_xfixesEventBase;
+    QHash<unsigned long, bool> m_hiddenCursors;
+
+    QString m_sessionPath;
+};
+
+Q_DECLARE_OPERATORS_FOR_FLAGS(SessionStateMonitor::Reasons)
+
+#endif // SESSIONSTATEMONITOR_H
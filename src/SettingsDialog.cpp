@@ -22,6 +22,7 @@
 
 #include "SettingsDialog.h"
 #include "SettingsManager.h"
+#include "RendererRegistry.h"
 #include <QVBoxLayout>
 #include <QHBoxLayout>
 #include <QGridLayout>
@@ -40,6 +41,10 @@
 #include <QPainter>
 #include <QStyledItemDelegate>
 
+#if defined(HAVE_X11) && defined(HAVE_XCB)
+#include "X11GlobalHotkey.h"
+#endif
+
 // Custom delegate to draw shape icons in the combobox
 class ShapeItemDelegate : public QStyledItemDelegate
 {
@@ -306,8 +311,15 @@ void SettingsDialog::setupUI()
     setTabOrder(m_shapeSpacingSlider, m_directionShapeCombo);
     setTabOrder(m_directionShapeCombo, m_autoStartCheckBox);
     setTabOrder(m_autoStartCheckBox, m_activateOnStartCheckBox);
-    setTabOrder(m_activateOnStartCheckBox, m_hotkeyEdit);
-    setTabOrder(m_hotkeyEdit, m_restoreDefaultsButton);
+    setTabOrder(m_activateOnStartCheckBox, m_motionPredictionCheckBox);
+    setTabOrder(m_motionPredictionCheckBox, m_autoSuspendCheckBox);
+    setTabOrder(m_autoSuspendCheckBox, m_lowPowerCheckBox);
+    setTabOrder(m_lowPowerCheckBox, m_autoHideSpinBox);
+    setTabOrder(m_autoHideSpinBox, m_shakeToLocateCheckBox);
+    setTabOrder(m_shakeToLocateCheckBox, m_rendererCombo);
+    setTabOrder(m_rendererCombo, m_hotkeyEdit);
+    setTabOrder(m_hotkeyEdit, m_momentaryHotkeyCheckBox);
+    setTabOrder(m_momentaryHotkeyCheckBox, m_restoreDefaultsButton);
     setTabOrder(m_restoreDefaultsButton, m_closeButton);
 }
 
@@ -483,6 +495,70 @@ void SettingsDialog::createBehaviorGroup()
     m_activateOnStartCheckBox->setToolTip(tr("The crosshair will be visible as soon as MouseCross starts"));
     connect(m_activateOnStartCheckBox, &QCheckBox::toggled, this, &SettingsDialog::onActivateOnStartChanged);
     layout->addWidget(m_activateOnStartCheckBox);
+    
+    m_motionPredictionCheckBox = new QCheckBox(tr("Predict fast cursor movement"), this);
+    m_motionPredictionCheckBox->setAccessibleName(tr("Motion Prediction"));
+    m_motionPredictionCheckBox->setAccessibleDescription(tr("Draw the crosshair slightly ahead of a fast moving cursor so it does not trail behind"));
+    m_motionPredictionCheckBox->setToolTip(tr("Reduces the lag of the crosshair behind a fast cursor; paused during sharp direction changes"));
+    connect(m_motionPredictionCheckBox, &QCheckBox::toggled, this, &SettingsDialog::onMotionPredictionChanged);
+    layout->addWidget(m_motionPredictionCheckBox);
+    
+    m_autoSuspendCheckBox = new QCheckBox(tr("Hide over fullscreen applications and locked screens"), this);
+    m_autoSuspendCheckBox->setAccessibleName(tr("Automatic Suspend"));
+    m_autoSuspendCheckBox->setAccessibleDescription(tr("Pause the crosshair while a fullscreen application is active, an application hides the cursor or the screen is locked"));
+    m_autoSuspendCheckBox->setToolTip(tr("The crosshair comes back as soon as the fullscreen application, hidden cursor or lock screen is gone"));
+    connect(m_autoSuspendCheckBox, &QCheckBox::toggled, this, &SettingsDialog::onAutoSuspendChanged);
+    layout->addWidget(m_autoSuspendCheckBox);
+    
+    m_lowPowerCheckBox = new QCheckBox(tr("Save power on battery"), this);
+    m_lowPowerCheckBox->setAccessibleName(tr("Low Power Profile"));
+    m_lowPowerCheckBox->setAccessibleDescription(tr("Lower the frame rate and simplify the crosshair while the computer runs on battery"));
+    m_lowPowerCheckBox->setToolTip(tr("On battery the crosshair updates less often and is drawn without direction shapes and smoothing"));
+    connect(m_lowPowerCheckBox, &QCheckBox::toggled, this, &SettingsDialog::onLowPowerProfileChanged);
+    layout->addWidget(m_lowPowerCheckBox);
+    
+    auto* autoHideLayout = new QHBoxLayout();
+    QLabel* autoHideLabel = new QLabel(tr("Hide when the mouse rests for:"), this);
+    autoHideLayout->addWidget(autoHideLabel);
+    m_autoHideSpinBox = new QSpinBox(this);
+    m_autoHideSpinBox->setRange(0, 3600);
+    m_autoHideSpinBox->setSuffix(tr(" s"));
+    m_autoHideSpinBox->setSpecialValueText(tr("Never"));
+    m_autoHideSpinBox->setAccessibleName(tr("Auto-hide Delay"));
+    m_autoHideSpinBox->setAccessibleDescription(tr("Seconds without mouse movement before the crosshair is hidden, it returns on the next movement"));
+    m_autoHideSpinBox->setToolTip(tr("The crosshair reappears as soon as the mouse moves"));
+    autoHideLabel->setBuddy(m_autoHideSpinBox);
+    connect(m_autoHideSpinBox, QOverload<int>::of(&QSpinBox::valueChanged), this, &SettingsDialog::onAutoHideChanged);
+    autoHideLayout->addWidget(m_autoHideSpinBox, 1);
+    layout->addLayout(autoHideLayout);
+    
+    m_shakeToLocateCheckBox = new QCheckBox(tr("Show the crosshair only when the mouse is shaken"), this);
+    m_shakeToLocateCheckBox->setAccessibleName(tr("Shake to Locate"));
+    m_shakeToLocateCheckBox->setAccessibleDescription(tr("Keep the crosshair hidden until the mouse is moved quickly back and forth"));
+    m_shakeToLocateCheckBox->setToolTip(tr("Shake the mouse to show the crosshair, it hides again a few seconds after the mouse rests"));
+    connect(m_shakeToLocateCheckBox, &QCheckBox::toggled, this, &SettingsDialog::onShakeToLocateChanged);
+    layout->addWidget(m_shakeToLocateCheckBox);
+    
+    auto* rendererLayout = new QHBoxLayout();
+    QLabel* rendererLabel = new QLabel(tr("Renderer:"), this);
+    rendererLayout->addWidget(rendererLabel);
+    m_rendererCombo = new QComboBox(this);
+    m_rendererCombo->setAccessibleName(tr("Renderer Backend"));
+    m_rendererCombo->setAccessibleDescription(tr("Drawing method used for the crosshair overlay"));
+    m_rendererCombo->setToolTip(tr("Automatic uses the fastest renderer measured on this computer"));
+    m_rendererCombo->addItem(tr("Automatic"), QStringLiteral("auto"));
+    for (const RendererRegistry::Backend* backend : RendererRegistry::availableBackends(RendererCapabilities::probe())) {
+        m_rendererCombo->addItem(backend->displayName, backend->id);
+    }
+    rendererLabel->setBuddy(m_rendererCombo);
+    connect(m_rendererCombo, QOverload<int>::of(&QComboBox::currentIndexChanged), this, &SettingsDialog::onRendererChanged);
+    rendererLayout->addWidget(m_rendererCombo, 1);
+    layout->addLayout(rendererLayout);
+    
+    // Nothing to choose between when only one backend works in this session
+    const bool hasChoice = m_rendererCombo->count() > 2;
+    rendererLabel->setVisible(hasChoice);
+    m_rendererCombo->setVisible(hasChoice);
 }
 
 void SettingsDialog::createHotkeyGroup()
@@ -501,6 +577,20 @@ void SettingsDialog::createHotkeyGroup()
     hotkeyLabel->setBuddy(m_hotkeyEdit);
     connect(m_hotkeyEdit, &QKeySequenceEdit::keySequenceChanged, this, &SettingsDialog::onHotkeyChanged);
     layout->addWidget(m_hotkeyEdit);
+    
+    m_momentaryHotkeyCheckBox = new QCheckBox(tr("Show only while &held"), this);
+    m_momentaryHotkeyCheckBox->setAccessibleName(tr("Show only while held"));
+    m_momentaryHotkeyCheckBox->setAccessibleDescription(tr("Show the crosshair while the hotkey is held down and hide it on release"));
+    m_momentaryHotkeyCheckBox->setToolTip(tr("Hold the hotkey to show the crosshair, release it to hide the crosshair again"));
+    connect(m_momentaryHotkeyCheckBox, &QCheckBox::toggled, this, &SettingsDialog::onMomentaryHotkeyChanged);
+    layout->addWidget(m_momentaryHotkeyCheckBox);
+    
+    // Only the X11 hotkey reports key releases
+    bool hasRelease = false;
+#if defined(HAVE_X11) && defined(HAVE_XCB)
+    hasRelease = X11GlobalHotkey::isSupported();
+#endif
+    m_momentaryHotkeyCheckBox->setVisible(hasRelease);
 }
 
 void SettingsDialog::loadSettings()
@@ -521,8 +611,17 @@ void SettingsDialog::loadSettings()
     
     m_autoStartCheckBox->setChecked(m_settings->autoStart());
     m_activateOnStartCheckBox->setChecked(m_settings->activateOnStart());
+    m_motionPredictionCheckBox->setChecked(m_settings->motionPrediction());
+    m_autoSuspendCheckBox->setChecked(m_settings->autoSuspend());
+    m_lowPowerCheckBox->setChecked(m_settings->lowPowerProfile());
+    m_autoHideSpinBox->setValue(m_settings->autoHideSeconds());
+    m_shakeToLocateCheckBox->setChecked(m_settings->shakeToLocate());
+    
+    int rendererIndex = m_rendererCombo->findData(m_settings->rendererBackend());
+    m_rendererCombo->setCurrentIndex(rendererIndex >= 0 ? rendererIndex : 0);
     
     m_hotkeyEdit->setKeySequence(QKeySequence(m_settings->toggleHotkey()));
+    m_momentaryHotkeyCheckBox->setChecked(m_settings->momentaryHotkey());
 }
 
 
@@ -569,8 +668,15 @@ void SettingsDialog::onRestoreDefaults()
     
     m_autoStartCheckBox->setChecked(false);
     m_activateOnStartCheckBox->setChecked(true);
+    m_motionPredictionCheckBox->setChecked(false);
+    m_autoSuspendCheckBox->setChecked(true);
+    m_lowPowerCheckBox->setChecked(true);
+    m_autoHideSpinBox->setValue(0);
+    m_shakeToLocateCheckBox->setChecked(false);
+    m_rendererCombo->setCurrentIndex(0); // Automatic
     
     m_hotkeyEdit->setKeySequence(QKeySequence("Ctrl+Alt+Shift+C"));
+    m_momentaryHotkeyCheckBox->setChecked(false);
 }
 
 // Immediate settings application slots
@@ -628,8 +734,50 @@ void SettingsDialog::onActivateOnStartChanged(bool checked)
     emit settingsChanged();
 }
 
+void SettingsDialog::onMotionPredictionChanged(bool checked)
+{
+    m_settings->setMotionPrediction(checked);
+    emit settingsChanged();
+}
+
+void SettingsDialog::onAutoSuspendChanged(bool checked)
+{
+    m_settings->setAutoSuspend(checked);
+    emit settingsChanged();
+}
+
+void SettingsDialog::onLowPowerProfileChanged(bool checked)
+{
+    m_settings->setLowPowerProfile(checked);
+    emit settingsChanged();
+}
+
+void SettingsDialog::onAutoHideChanged(int value)
+{
+    m_settings->setAutoHideSeconds(value);
+    emit settingsChanged();
+}
+
+void SettingsDialog::onShakeToLocateChanged(bool checked)
+{
+    m_settings->setShakeToLocate(checked);
+    emit settingsChanged();
+}
+
+void SettingsDialog::onRendererChanged(int index)
+{
+    m_settings->setRendererBackend(m_rendererCombo->itemData(index).toString());
+    emit settingsChanged();
+}
+
 void SettingsDialog::onHotkeyChanged(const QKeySequence& keySequence)
 {
     m_settings->setToggleHotkey(keySequence.toString());
     emit settingsChanged();
-}
\ No newline at end of file
+}
+
+void SettingsDialog::onMomentaryHotkeyChanged(bool checked)
+{
+    m_settings->setMomentaryHotkey(checked);
+    emit settingsChanged();
+}
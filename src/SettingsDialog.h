@@ -60,7 +60,14 @@ private slots:
     void onDirectionShapeChanged(int index);
     void onAutoStartChanged(bool checked);
     void onActivateOnStartChanged(bool checked);
+    void onMotionPredictionChanged(bool checked);
+    void onAutoSuspendChanged(bool checked);
+    void onAutoHideChanged(int value);
+    void onShakeToLocateChanged(bool checked);
+    void onLowPowerProfileChanged(bool checked);
+    void onRendererChanged(int index);
     void onHotkeyChanged(const QKeySequence& keySequence);
+    void onMomentaryHotkeyChanged(bool checked);
 
 private:
     void setupUI();
@@ -90,10 +97,17 @@ private:
     QGroupBox* m_behaviorGroup;
     QCheckBox* m_autoStartCheckBox;
     QCheckBox* m_activateOnStartCheckBox;
+    QCheckBox* m_motionPredictionCheckBox;
+    QCheckBox* m_autoSuspendCheckBox;
+    QCheckBox* m_lowPowerCheckBox;
+    QSpinBox* m_autoHideSpinBox;
+    QCheckBox* m_shakeToLocateCheckBox;
+    QComboBox* m_rendererCombo;
     
     // Hotkey controls
     QGroupBox* m_hotkeyGroup;
     QKeySequenceEdit* m_hotkeyEdit;
+    QCheckBox* m_momentaryHotkeyCheckBox;
     
     // Dialog buttons
     QPushButton* m_closeButton;
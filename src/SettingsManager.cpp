@@ -23,6 +23,107 @@
 #include "SettingsManager.h"
 #include <QColor>
 #include <QKeySequence>
+#include <QStringList>
+#include <QMap>
+#include <cstring>
+#include "RendererRegistry.h"
+
+namespace {
+
+enum class ValueType { Int, Double, Bool, Color, KeySequence, Backend };
+
+// Settings the control channel may change, with the ranges of the settings dialog.
+// Bookkeeping such as firstRun or the benchmark result is not listed.
+struct ControlledValue {
+    const char* key;
+    ValueType type;
+    double minimum;
+    double maximum;
+};
+
+const ControlledValue ControlledValues[] = {
+    { "crosshair/lineWidth", ValueType::Int, 3, 10 },
+    { "crosshair/offsetFromCursor", ValueType::Int, 0, 100 },
+    { "crosshair/thicknessMultiplier", ValueType::Double, 1.0, 10.0 },
+    { "crosshair/color", ValueType::Color, 0, 0 },
+    { "crosshair/opacity", ValueType::Double, 0.1, 1.0 },
+    { "crosshair/showArrows", ValueType::Bool, 0, 1 },
+    { "crosshair/colorPerPointer", ValueType::Bool, 0, 1 },
+    { "crosshair/circleSpacingIncrease", ValueType::Double, 1.0, 10.0 },
+    { "crosshair/directionShape", ValueType::Int, 0, 3 },
+    { "behavior/activateOnStart", ValueType::Bool, 0, 1 },
+    { "behavior/motionPrediction", ValueType::Bool, 0, 1 },
+    { "behavior/autoHideSeconds", ValueType::Int, 0, 3600 },
+    { "behavior/shakeToLocate", ValueType::Bool, 0, 1 },
+    { "behavior/shakeShowSeconds", ValueType::Int, 1, 60 },
+    { "behavior/autoSuspend", ValueType::Bool, 0, 1 },
+    { "power/lowPowerProfile", ValueType::Bool, 0, 1 },
+    { "power/frameRate", ValueType::Int, 10, 240 },
+    { "power/directionShapes", ValueType::Bool, 0, 1 },
+    { "power/antialiasing", ValueType::Bool, 0, 1 },
+    { "remote/profile", ValueType::Bool, 0, 1 },
+    { "remote/frameRate", ValueType::Int, 5, 120 },
+    { "hotkey/toggle", ValueType::KeySequence, 0, 0 },
+    { "hotkey/momentary", ValueType::Bool, 0, 1 },
+    { "cursor/pollIdleTicks", ValueType::Int, 1, 1000 },
+    { "cursor/jitterFilter", ValueType::Bool, 0, 1 },
+    { "cursor/jitterDeadZone", ValueType::Int, 0, 16 },
+    { "renderer/backend", ValueType::Backend, 0, 0 },
+    { "renderer/adaptiveQuality", ValueType::Bool, 0, 1 },
+    { "renderer/warmToggle", ValueType::Bool, 0, 1 },
+};
+
+const ControlledValue* findControlledValue(const QString& key)
+{
+    const QByteArray latin1 = key.toLatin1();
+    for (const ControlledValue& controlled : ControlledValues) {
+        if (std::strcmp(controlled.key, latin1.constData()) == 0) return &controlled;
+    }
+    return nullptr;
+}
+
+// The value as stored in the settings file, invalid when text does not parse or is out of range
+QVariant parseControlledValue(const ControlledValue& controlled, const QString& text)
+{
+    bool ok = false;
+    switch (controlled.type) {
+    case ValueType::Int: {
+        const int value = text.toInt(&ok);
+        if (ok && value >= controlled.minimum && value <= controlled.maximum) return value;
+        break;
+    }
+    case ValueType::Double: {
+        const double value = text.toDouble(&ok);
+        if (ok && value >= controlled.minimum && value <= controlled.maximum) return value;
+        break;
+    }
+    case ValueType::Bool: {
+        const QString lower = text.toLower();
+        if (lower == QLatin1String("true") || lower == QLatin1String("1") || lower == QLatin1String("on")) return true;
+        if (lower == QLatin1String("false") || lower == QLatin1String("0") || lower == QLatin1String("off")) return false;
+        break;
+    }
+    case ValueType::Color: {
+        const QColor color(text);
+        if (color.isValid()) return color.name();
+        break;
+    }
+    case ValueType::KeySequence: {
+        const QKeySequence sequence = QKeySequence::fromString(text, QKeySequence::PortableText);
+        if (!sequence.isEmpty() && sequence[0].key() != Qt::Key_unknown) return sequence.toString(QKeySequence::PortableText);
+        break;
+    }
+    case ValueType::Backend: {
+        if (text == QLatin1String("auto")) return text;
+        const RendererRegistry::Backend* backend = RendererRegistry::find(text);
+        if (backend && !backend->experimental) return text;
+        break;
+    }
+    }
+    return QVariant();
+}
+
+}
 
 SettingsManager::SettingsManager(QObject *parent)
     : QObject(parent)
@@ -63,6 +164,10 @@ void SettingsManager::setDefaultValues()
         m_settings.setValue("crosshair/showArrows", true);
     }
     
+    if (!m_settings.contains("crosshair/colorPerPointer")) {
+        m_settings.setValue("crosshair/colorPerPointer", true);
+    }
+    
     if (!m_settings.contains("crosshair/circleSpacingIncrease")) {
         m_settings.setValue("crosshair/circleSpacingIncrease", 5.0);  // Default 5%
     }
@@ -79,6 +184,50 @@ void SettingsManager::setDefaultValues()
         m_settings.setValue("behavior/activateOnStart", true);
     }
     
+    if (!m_settings.contains("behavior/motionPrediction")) {
+        m_settings.setValue("behavior/motionPrediction", false);
+    }
+    
+    if (!m_settings.contains("behavior/autoHideSeconds")) {
+        m_settings.setValue("behavior/autoHideSeconds", 0);
+    }
+    
+    if (!m_settings.contains("behavior/shakeToLocate")) {
+        m_settings.setValue("behavior/shakeToLocate", false);
+    }
+    
+    if (!m_settings.contains("behavior/shakeShowSeconds")) {
+        m_settings.setValue("behavior/shakeShowSeconds", 3);
+    }
+    
+    if (!m_settings.contains("behavior/autoSuspend")) {
+        m_settings.setValue("behavior/autoSuspend", true);
+    }
+    
+    if (!m_settings.contains("power/lowPowerProfile")) {
+        m_settings.setValue("power/lowPowerProfile", true);
+    }
+    
+    if (!m_settings.contains("power/frameRate")) {
+        m_settings.setValue("power/frameRate", 30);
+    }
+    
+    if (!m_settings.contains("power/directionShapes")) {
+        m_settings.setValue("power/directionShapes", false);
+    }
+    
+    if (!m_settings.contains("power/antialiasing")) {
+        m_settings.setValue("power/antialiasing", false);
+    }
+    
+    if (!m_settings.contains("remote/profile")) {
+        m_settings.setValue("remote/profile", true);
+    }
+    
+    if (!m_settings.contains("remote/frameRate")) {
+        m_settings.setValue("remote/frameRate", 20);
+    }
+    
     if (!m_settings.contains("hotkey/toggle")) {
 #ifdef Q_OS_MAC
         // On Mac, use Cmd+Option+Shift+C (more natural for Mac users)
@@ -88,6 +237,38 @@ void SettingsManager::setDefaultValues()
         m_settings.setValue("hotkey/toggle", "Ctrl+Alt+Shift+C");
 #endif
     }
+    
+    if (!m_settings.contains("hotkey/momentary")) {
+        m_settings.setValue("hotkey/momentary", false);
+    }
+    
+    if (!m_settings.contains("cursor/pollIdleIntervals")) {
+        m_settings.setValue("cursor/pollIdleIntervals", "50,250");
+    }
+    
+    if (!m_settings.contains("cursor/pollIdleTicks")) {
+        m_settings.setValue("cursor/pollIdleTicks", 30);
+    }
+    
+    if (!m_settings.contains("cursor/jitterFilter")) {
+        m_settings.setValue("cursor/jitterFilter", true);
+    }
+    
+    if (!m_settings.contains("cursor/jitterDeadZone")) {
+        m_settings.setValue("cursor/jitterDeadZone", 2);
+    }
+    
+    if (!m_settings.contains("renderer/backend")) {
+        m_settings.setValue("renderer/backend", "auto");
+    }
+    
+    if (!m_settings.contains("renderer/adaptiveQuality")) {
+        m_settings.setValue("renderer/adaptiveQuality", true);
+    }
+    
+    if (!m_settings.contains("renderer/warmToggle")) {
+        m_settings.setValue("renderer/warmToggle", false);
+    }
 }
 
 bool SettingsManager::isFirstRun() const
@@ -168,6 +349,17 @@ void SettingsManager::setShowArrows(bool show)
     emit settingsChanged();
 }
 
+bool SettingsManager::colorPerPointer() const
+{
+    return m_settings.value("crosshair/colorPerPointer", true).toBool();
+}
+
+void SettingsManager::setColorPerPointer(bool enabled)
+{
+    m_settings.setValue("crosshair/colorPerPointer", enabled);
+    emit settingsChanged();
+}
+
 bool SettingsManager::autoStart() const
 {
     return m_settings.value("behavior/autoStart", false).toBool();
@@ -190,6 +382,127 @@ void SettingsManager::setActivateOnStart(bool activate)
     emit settingsChanged();
 }
 
+bool SettingsManager::motionPrediction() const
+{
+    return m_settings.value("behavior/motionPrediction", false).toBool();
+}
+
+void SettingsManager::setMotionPrediction(bool enabled)
+{
+    m_settings.setValue("behavior/motionPrediction", enabled);
+    emit settingsChanged();
+}
+
+bool SettingsManager::lowPowerProfile() const
+{
+    return m_settings.value("power/lowPowerProfile", true).toBool();
+}
+
+void SettingsManager::setLowPowerProfile(bool enabled)
+{
+    m_settings.setValue("power/lowPowerProfile", enabled);
+    emit settingsChanged();
+}
+
+int SettingsManager::lowPowerFrameRate() const
+{
+    return qBound(10, m_settings.value("power/frameRate", 30).toInt(), 240);
+}
+
+void SettingsManager::setLowPowerFrameRate(int hz)
+{
+    m_settings.setValue("power/frameRate", qBound(10, hz, 240));
+    emit settingsChanged();
+}
+
+bool SettingsManager::lowPowerDirectionShapes() const
+{
+    return m_settings.value("power/directionShapes", false).toBool();
+}
+
+void SettingsManager::setLowPowerDirectionShapes(bool show)
+{
+    m_settings.setValue("power/directionShapes", show);
+    emit settingsChanged();
+}
+
+bool SettingsManager::lowPowerAntialiasing() const
+{
+    return m_settings.value("power/antialiasing", false).toBool();
+}
+
+void SettingsManager::setLowPowerAntialiasing(bool enabled)
+{
+    m_settings.setValue("power/antialiasing", enabled);
+    emit settingsChanged();
+}
+
+bool SettingsManager::remoteProfile() const
+{
+    return m_settings.value("remote/profile", true).toBool();
+}
+
+void SettingsManager::setRemoteProfile(bool enabled)
+{
+    m_settings.setValue("remote/profile", enabled);
+    emit settingsChanged();
+}
+
+int SettingsManager::remoteFrameRate() const
+{
+    return qBound(5, m_settings.value("remote/frameRate", 20).toInt(), 120);
+}
+
+void SettingsManager::setRemoteFrameRate(int hz)
+{
+    m_settings.setValue("remote/frameRate", qBound(5, hz, 120));
+    emit settingsChanged();
+}
+
+int SettingsManager::autoHideSeconds() const
+{
+    return qBound(0, m_settings.value("behavior/autoHideSeconds", 0).toInt(), 3600);
+}
+
+void SettingsManager::setAutoHideSeconds(int seconds)
+{
+    m_settings.setValue("behavior/autoHideSeconds", qBound(0, seconds, 3600));
+    emit settingsChanged();
+}
+
+bool SettingsManager::shakeToLocate() const
+{
+    return m_settings.value("behavior/shakeToLocate", false).toBool();
+}
+
+void SettingsManager::setShakeToLocate(bool enabled)
+{
+    m_settings.setValue("behavior/shakeToLocate", enabled);
+    emit settingsChanged();
+}
+
+int SettingsManager::shakeShowSeconds() const
+{
+    return qBound(1, m_settings.value("behavior/shakeShowSeconds", 3).toInt(), 60);
+}
+
+void SettingsManager::setShakeShowSeconds(int seconds)
+{
+    m_settings.setValue("behavior/shakeShowSeconds", qBound(1, seconds, 60));
+    emit settingsChanged();
+}
+
+bool SettingsManager::autoSuspend() const
+{
+    return m_settings.value("behavior/autoSuspend", true).toBool();
+}
+
+void SettingsManager::setAutoSuspend(bool enabled)
+{
+    m_settings.setValue("behavior/autoSuspend", enabled);
+    emit settingsChanged();
+}
+
 QString SettingsManager::toggleHotkey() const
 {
 #ifdef Q_OS_MAC
@@ -205,6 +518,17 @@ void SettingsManager::setToggleHotkey(const QString& hotkey)
     emit settingsChanged();
 }
 
+bool SettingsManager::momentaryHotkey() const
+{
+    return m_settings.value("hotkey/momentary", false).toBool();
+}
+
+void SettingsManager::setMomentaryHotkey(bool enabled)
+{
+    m_settings.setValue("hotkey/momentary", enabled);
+    emit settingsChanged();
+}
+
 double SettingsManager::circleSpacingIncrease() const
 {
     return m_settings.value("crosshair/circleSpacingIncrease", 5.0).toDouble();
@@ -228,4 +552,190 @@ void SettingsManager::setDirectionShape(CrosshairRenderer::DirectionShape shape)
 {
     m_settings.setValue("crosshair/directionShape", static_cast<int>(shape));
     emit settingsChanged();
-}
\ No newline at end of file
+}
+
+QList<int> SettingsManager::pollIdleIntervals() const
+{
+    QList<int> intervals;
+    const QStringList values = m_settings.value("cursor/pollIdleIntervals", "50,250").toString().split(',', Qt::SkipEmptyParts);
+    for (const QString& value : values) {
+        bool ok = false;
+        int interval = value.trimmed().toInt(&ok);
+        // Keep the steps increasing and below a second so a move is still noticed quickly
+        if (ok && interval > 0 && interval <= 1000 && (intervals.isEmpty() || interval > intervals.last())) {
+            intervals.append(interval);
+        }
+    }
+    return intervals;
+}
+
+void SettingsManager::setPollIdleIntervals(const QList<int>& intervals)
+{
+    QStringList values;
+    for (int interval : intervals) {
+        values.append(QString::number(interval));
+    }
+    m_settings.setValue("cursor/pollIdleIntervals", values.join(','));
+    emit settingsChanged();
+}
+
+int SettingsManager::pollIdleTicks() const
+{
+    return m_settings.value("cursor/pollIdleTicks", 30).toInt();
+}
+
+void SettingsManager::setPollIdleTicks(int ticks)
+{
+    m_settings.setValue("cursor/pollIdleTicks", qMax(1, ticks));
+    emit settingsChanged();
+}
+
+bool SettingsManager::jitterFilter() const
+{
+    return m_settings.value("cursor/jitterFilter", true).toBool();
+}
+
+void SettingsManager::setJitterFilter(bool enabled)
+{
+    m_settings.setValue("cursor/jitterFilter", enabled);
+    emit settingsChanged();
+}
+
+int SettingsManager::jitterDeadZone() const
+{
+    return qBound(0, m_settings.value("cursor/jitterDeadZone", 2).toInt(), 16);
+}
+
+void SettingsManager::setJitterDeadZone(int pixels)
+{
+    m_settings.setValue("cursor/jitterDeadZone", qBound(0, pixels, 16));
+    emit settingsChanged();
+}
+
+QString SettingsManager::rendererBackend() const
+{
+    return m_settings.value("renderer/backend", "auto").toString();
+}
+
+void SettingsManager::setRendererBackend(const QString& backend)
+{
+    m_settings.setValue("renderer/backend", backend);
+    emit settingsChanged();
+}
+
+bool SettingsManager::adaptiveQuality() const
+{
+    return m_settings.value("renderer/adaptiveQuality", true).toBool();
+}
+
+void SettingsManager::setAdaptiveQuality(bool enabled)
+{
+    m_settings.setValue("renderer/adaptiveQuality", enabled);
+    emit settingsChanged();
+}
+
+bool SettingsManager::warmToggle() const
+{
+    return m_settings.value("renderer/warmToggle", false).toBool();
+}
+
+void SettingsManager::setWarmToggle(bool enabled)
+{
+    m_settings.setValue("renderer/warmToggle", enabled);
+    emit settingsChanged();
+}
+
+QString SettingsManager::benchmarkedRenderer() const
+{
+    return m_settings.value("renderer/benchmarked").toString();
+}
+
+QString SettingsManager::rendererFingerprint() const
+{
+    return m_settings.value("renderer/fingerprint").toString();
+}
+
+void SettingsManager::setBenchmarkedRenderer(const QString& backend, const QString& fingerprint)
+{
+    // Bookkeeping only, the active renderer does not change, so no settingsChanged
+    m_settings.setValue("renderer/benchmarked", backend);
+    m_settings.setValue("renderer/fingerprint", fingerprint);
+}
+
+QList<SettingsManager::AppProfile> SettingsManager::appProfiles() const
+{
+    const QString prefix = QStringLiteral("profiles/");
+    const QString crosshairPrefix = QStringLiteral("crosshair/");
+
+    QMap<QString, AppProfile> profiles;
+    for (const QString& key : m_settings.allKeys()) {
+        if (!key.startsWith(prefix)) continue;
+        const int slash = key.indexOf('/', prefix.size());
+        if (slash < 0) continue;
+
+        AppProfile& profile = profiles[key.mid(prefix.size(), slash - prefix.size())];
+        profile.name = key.mid(prefix.size(), slash - prefix.size());
+        const QString field = key.mid(slash + 1);
+        if (field == QLatin1String("match")) {
+            // Written as a list, hand edited files may hold a single comma separated string
+            const QStringList values = m_settings.value(key).toStringList().join(',').split(',', Qt::SkipEmptyParts);
+            for (const QString& value : values) {
+                profile.matches.append(value.trimmed().toLower());
+            }
+        } else if (field == QLatin1String("exclude")) {
+            profile.exclude = m_settings.value(key).toBool();
+        } else if (field.startsWith(crosshairPrefix)) {
+            profile.overrides.insert(field.mid(crosshairPrefix.size()), m_settings.value(key));
+        }
+    }
+    return profiles.values();
+}
+
+void SettingsManager::setAppProfiles(const QList<AppProfile>& profiles)
+{
+    m_settings.remove("profiles");
+    for (const AppProfile& profile : profiles) {
+        const QString group = QStringLiteral("profiles/%1/").arg(profile.name);
+        m_settings.setValue(group + "match", profile.matches);
+        m_settings.setValue(group + "exclude", profile.exclude);
+        for (auto it = profile.overrides.constBegin(); it != profile.overrides.constEnd(); ++it) {
+            m_settings.setValue(group + "crosshair/" + it.key(), it.value());
+        }
+    }
+    emit settingsChanged();
+}
+
+bool SettingsManager::isControllable(const QString& key) const
+{
+    return findControlledValue(key) != nullptr;
+}
+
+QVariant SettingsManager::value(const QString& key) const
+{
+    return isControllable(key) ? m_settings.value(key) : QVariant();
+}
+
+bool SettingsManager::setValues(const QMap<QString, QString>& values, QString* error)
+{
+    // Parse everything first so a bad value leaves all settings untouched
+    QVariantMap parsed;
+    for (auto it = values.constBegin(); it != values.constEnd(); ++it) {
+        const ControlledValue* controlled = findControlledValue(it.key());
+        if (!controlled) {
+            if (error) *error = QStringLiteral("unknown setting: ") + it.key();
+            return false;
+        }
+        const QVariant value = parseControlledValue(*controlled, it.value());
+        if (!value.isValid()) {
+            if (error) *error = QStringLiteral("invalid value for %1: %2").arg(it.key(), it.value());
+            return false;
+        }
+        parsed.insert(it.key(), value);
+    }
+
+    for (auto it = parsed.constBegin(); it != parsed.constEnd(); ++it) {
+        m_settings.setValue(it.key(), it.value());
+    }
+    emit settingsChanged();
+    return true;
+}
@@ -26,6 +26,9 @@
 #include <QObject>
 #include <QSettings>
 #include <QColor>
+#include <QList>
+#include <QStringList>
+#include <QVariantMap>
 #include "CrosshairRenderer.h"
 
 class SettingsManager : public QObject
@@ -33,6 +36,15 @@ class SettingsManager : public QObject
     Q_OBJECT
 
 public:
+    // Settings used while a matching application has focus. Stored as
+    // profiles/<name>/match, profiles/<name>/exclude and profiles/<name>/crosshair/<key>.
+    struct AppProfile {
+        QString name;
+        QStringList matches;     // WM_CLASS instance or class, or process name, lower case
+        bool exclude = false;    // No crosshair while the application has focus
+        QVariantMap overrides;   // Replaces crosshair/<key>, e.g. "lineWidth"
+    };
+
     explicit SettingsManager(QObject *parent = nullptr);
     
     // First run
@@ -59,6 +71,10 @@ public:
     bool showArrows() const;
     void setShowArrows(bool show);
     
+    // One colour per master pointer when several are present (XInput2 MPX)
+    bool colorPerPointer() const;
+    void setColorPerPointer(bool enabled);
+    
     double circleSpacingIncrease() const;
     void setCircleSpacingIncrease(double percentage);
     
@@ -72,9 +88,96 @@ public:
     bool activateOnStart() const;
     void setActivateOnStart(bool activate);
     
+    bool motionPrediction() const;
+    void setMotionPrediction(bool enabled);
+    
+    // Seconds without pointer motion before the crosshair is hidden, 0 keeps it shown
+    int autoHideSeconds() const;
+    void setAutoHideSeconds(int seconds);
+    
+    // Locate on shake: the crosshair stays hidden until the mouse is shaken and is
+    // then shown until the mouse has rested for shakeShowSeconds
+    bool shakeToLocate() const;
+    void setShakeToLocate(bool enabled);
+    
+    int shakeShowSeconds() const;
+    void setShakeShowSeconds(int seconds);
+    
+    // Hide the crosshair over fullscreen windows, hidden cursors and locked screens
+    bool autoSuspend() const;
+    void setAutoSuspend(bool enabled);
+    
+    // Low power profile applied while running on battery
+    bool lowPowerProfile() const;
+    void setLowPowerProfile(bool enabled);
+    
+    int lowPowerFrameRate() const;
+    void setLowPowerFrameRate(int hz);
+    
+    bool lowPowerDirectionShapes() const;
+    void setLowPowerDirectionShapes(bool show);
+    
+    bool lowPowerAntialiasing() const;
+    void setLowPowerAntialiasing(bool enabled);
+    
+    // Bandwidth friendly profile applied in VNC, RDP and forwarded X sessions
+    bool remoteProfile() const;
+    void setRemoteProfile(bool enabled);
+    
+    int remoteFrameRate() const;
+    void setRemoteFrameRate(int hz);
+    
     // Hotkey
     QString toggleHotkey() const;
     void setToggleHotkey(const QString& hotkey);
+    
+    // Show the crosshair only while the hotkey is held, needs a hotkey that reports releases
+    bool momentaryHotkey() const;
+    void setMomentaryHotkey(bool enabled);
+    
+    // Cursor polling, slower intervals in ms used while the pointer rests and the
+    // number of still ticks before stepping down to the next one
+    QList<int> pollIdleIntervals() const;
+    void setPollIdleIntervals(const QList<int>& intervals);
+    
+    int pollIdleTicks() const;
+    void setPollIdleTicks(int ticks);
+    
+    // Jitter filter, small pointer oscillations inside the dead zone (px) are not drawn
+    bool jitterFilter() const;
+    void setJitterFilter(bool enabled);
+    
+    int jitterDeadZone() const;
+    void setJitterDeadZone(int pixels);
+    
+    // Renderer backend, "auto" picks the benchmarked or default backend
+    QString rendererBackend() const;
+    void setRendererBackend(const QString& backend);
+    
+    // Lower the render quality while frames overrun the frame budget
+    bool adaptiveQuality() const;
+    void setAdaptiveQuality(bool enabled);
+    
+    // Keep the overlay mapped but empty while hidden, so showing it is a single repaint
+    bool warmToggle() const;
+    void setWarmToggle(bool enabled);
+    
+    // Result of the startup benchmark and the session it was measured in
+    QString benchmarkedRenderer() const;
+    QString rendererFingerprint() const;
+    void setBenchmarkedRenderer(const QString& backend, const QString& fingerprint);
+    
+    // Per application profiles
+    QList<AppProfile> appProfiles() const;
+    void setAppProfiles(const QList<AppProfile>& profiles);
+    
+    // Access by key, e.g. "crosshair/lineWidth", for the control channel. Only user
+    // settings are controllable, values are parsed and range checked like in the
+    // settings dialog. setValues() applies all values with a single settingsChanged()
+    // or none if one is rejected, error then says which.
+    bool isControllable(const QString& key) const;
+    QVariant value(const QString& key) const;
+    bool setValues(const QMap<QString, QString>& values, QString* error = nullptr);
 
 signals:
     void settingsChanged();
@@ -0,0 +1,101 @@
+/*
+ * MouseCross - A crosshair overlay application for visually impaired users
+ * Copyright (C) 2025 Stefan Lohmaier <stefan@slohmaier.de>
+ *
+ * This file is part of MouseCross.
+ *
+ * MouseCross is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MouseCross is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with MouseCross. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Project website: https://slohmaier.de/mousecross
+ */
+
+#include "ShakeDetector.h"
+
+namespace {
+
+// A shake is at least ShakeReversals direction changes of MinSwing px or more
+// within ShakeWindowNs, along either axis. Normal pointing rarely reverses
+// three times in under a second.
+const qint64 ShakeWindowNs = 800 * 1000 * 1000;
+const int MinSwing = 40;
+const int ShakeReversals = 3;
+
+}
+
+ShakeDetector::ShakeDetector()
+    : m_head(0)
+    , m_count(0)
+{
+}
+
+void ShakeDetector::reset()
+{
+    m_head = 0;
+    m_count = 0;
+}
+
+bool ShakeDetector::addSample(const QPoint& pos, qint64 timestamp)
+{
+    m_samples[m_head] = { pos, timestamp };
+    m_head = (m_head + 1) % Capacity;
+    if (m_count < Capacity) ++m_count;
+
+    const qint64 since = timestamp - ShakeWindowNs;
+    if (countReversals(true, since) >= ShakeReversals || countReversals(false, since) >= ShakeReversals) {
+        // Start over so one shake shows the crosshair once
+        reset();
+        return true;
+    }
+    return false;
+}
+
+int ShakeDetector::countReversals(bool horizontal, qint64 since) const
+{
+    int reversals = 0;
+    int direction = 0;
+    int swing = 0;
+    bool hasPrevious = false;
+    int previous = 0;
+
+    // Oldest to newest, skipping samples that fell out of the window
+    for (int i = 0; i < m_count; ++i) {
+        const Sample& sample = m_samples[(m_head - m_count + i + Capacity) % Capacity];
+        if (sample.timestamp < since) continue;
+
+        const int value = horizontal ? sample.pos.x() : sample.pos.y();
+        if (!hasPrevious) {
+            previous = value;
+            hasPrevious = true;
+            continue;
+        }
+
+        const int delta = value - previous;
+        previous = value;
+        if (delta == 0) continue;
+
+        const int step = delta > 0 ? 1 : -1;
+        if (step == direction) {
+            swing += qAbs(delta);
+            continue;
+        }
+
+        // Only count a turn when the swing before it was a real one
+        if (direction != 0 && swing >= MinSwing) {
+            ++reversals;
+        }
+        direction = step;
+        swing = qAbs(delta);
+    }
+    return reversals;
+}
@@ -0,0 +1,57 @@
+/*
+ * MouseCross - A crosshair overlay application for visually impaired users
+ * Copyright (C) 2025 Stefan Lohmaier <stefan@slohmaier.de>
+ *
+ * This file is part of MouseCross.
+ *
+ * MouseCross is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MouseCross is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with MouseCross. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Project website: https://slohmaier.de/mousecross
+ */
+
+#ifndef SHAKEDETECTOR_H
+#define SHAKEDETECTOR_H
+
+#include <QPoint>
+#include <array>
+
+// Recognizes a quick back-and-forth shake of the pointer. Samples go into a
+// fixed ring buffer, so feeding motion never allocates, and the detector only
+// does work when a motion sample arrives.
+class ShakeDetector
+{
+public:
+    ShakeDetector();
+
+    void reset();
+
+    // Feeds one motion sample (timestamp in ns), true when it completes a shake
+    bool addSample(const QPoint& pos, qint64 timestamp);
+
+private:
+    struct Sample {
+        QPoint pos;
+        qint64 timestamp = 0;
+    };
+
+    // Direction changes of at least MinSwing px along one axis inside the window
+    int countReversals(bool horizontal, qint64 since) const;
+
+    static const int Capacity = 128;
+    std::array<Sample, Capacity> m_samples;
+    int m_head;
+    int m_count;
+};
+
+#endif // SHAKEDETECTOR_H
@@ -0,0 +1,91 @@
+/*
+ * MouseCross - A crosshair overlay application for visually impaired users
+ * Copyright (C) 2025 Stefan Lohmaier <stefan@slohmaier.de>
+ *
+ * This file is part of MouseCross.
+ *
+ * MouseCross is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MouseCross is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with MouseCross. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Project website: https://slohmaier.de/mousecross
+ */
+
+#include "StartupProfile.h"
+#include "Logging.h"
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QVector>
+#include <cstdio>
+#include <cstring>
+
+namespace
+{
+    struct Phase {
+        const char* name;
+        qint64 elapsed; // ns since start()
+    };
+
+    QElapsedTimer s_timer;
+    QVector<Phase> s_phases;
+    bool s_benchmark = false;
+    bool s_finished = false;
+}
+
+namespace StartupProfile
+{
+    void start(bool benchmark)
+    {
+        s_benchmark = benchmark;
+        s_phases.reserve(12);
+        s_timer.start();
+    }
+
+    bool isBenchmark()
+    {
+        return s_benchmark;
+    }
+
+    void mark(const char* phase)
+    {
+        if (s_finished || !s_timer.isValid()) return;
+        s_phases.append({phase, s_timer.nsecsElapsed()});
+    }
+
+    void finish()
+    {
+        if (s_finished || !s_timer.isValid()) return;
+        mark("startup complete");
+        s_finished = true;
+
+        qint64 trayIcon = -1;
+        qint64 previous = 0;
+        for (const Phase& phase : s_phases) {
+            if (std::strcmp(phase.name, "tray icon") == 0) trayIcon = phase.elapsed;
+            if (s_benchmark) {
+                std::printf("%-20s %8.2f ms  (+%.2f ms)\n", phase.name,
+                            phase.elapsed / 1e6, (phase.elapsed - previous) / 1e6);
+            } else {
+                qCDebug(lcDiagnostics) << "Startup:" << phase.name << "after" << phase.elapsed / 1000 << "us";
+            }
+            previous = phase.elapsed;
+        }
+
+        if (!s_benchmark) return;
+
+        // Fails the benchmark when the tray icon came up too late
+        const bool withinTarget = trayIcon >= 0 && trayIcon <= qint64(TrayIconTargetMs) * 1000000;
+        std::printf("Tray icon target %d ms: %s\n", TrayIconTargetMs, withinTarget ? "met" : "missed");
+        std::fflush(stdout);
+        QCoreApplication::exit(withinTarget ? 0 : 1);
+    }
+}
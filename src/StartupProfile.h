@@ -0,0 +1,44 @@
+/*
+ * MouseCross - A crosshair overlay application for visually impaired users
+ * Copyright (C) 2025 Stefan Lohmaier <stefan@slohmaier.de>
+ *
+ * This file is part of MouseCross.
+ *
+ * MouseCross is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MouseCross is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with MouseCross. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Project website: https://slohmaier.de/mousecross
+ */
+
+#ifndef STARTUPPROFILE_H
+#define STARTUPPROFILE_H
+
+// Timestamps of the startup phases, measured from the top of main(). The
+// phases are logged once startup is complete. With --startup-benchmark the
+// application prints them and exits instead of staying in the tray.
+namespace StartupProfile
+{
+    void start(bool benchmark);
+    bool isBenchmark();
+
+    // Records the end of a phase, phase must be a string literal
+    void mark(const char* phase);
+
+    // Logs the phases, quits in benchmark mode
+    void finish();
+
+    // Time to the tray icon a cold start should stay under
+    constexpr int TrayIconTargetMs = 100;
+}
+
+#endif // STARTUPPROFILE_H
@@ -0,0 +1,573 @@
+/*
+ * MouseCross - A crosshair overlay application for visually impaired users
+ * Copyright (C) 2025 Stefan Lohmaier <stefan@slohmaier.de>
+ *
+ * This file is part of MouseCross.
+ *
+ * MouseCross is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MouseCross is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with MouseCross. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Project website: https://slohmaier.de/mousecross
+ */
+
+#include "WaylandCrosshairRenderer.h"
+#include "CrosshairGeometry.h"
+#include <QApplication>
+#include <QScreen>
+#include <QCursor>
+#include <QImage>
+#include <QPainter>
+#include <QSocketNotifier>
+#include <QDebug>
+#include <QElapsedTimer>
+#include <cstring>
+
+#include <sys/mman.h>
+#include <unistd.h>
+#include <wayland-client.h>
+#include "wlr-layer-shell-unstable-v1-client-protocol.h"
+#include "viewporter-client-protocol.h"
+
+namespace {
+
+int createShmFile(size_t size)
+{
+    int fd = memfd_create("mousecross-shm", MFD_CLOEXEC);
+    if (fd < 0) return -1;
+    if (ftruncate(fd, static_cast<off_t>(size)) < 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+struct GlobalProbe {
+    bool layerShell = false;
+    bool viewporter = false;
+    bool subcompositor = false;
+};
+
+void probeGlobal(void* data, wl_registry*, uint32_t, const char* interface, uint32_t)
+{
+    auto* probe = static_cast<GlobalProbe*>(data);
+    if (std::strcmp(interface, zwlr_layer_shell_v1_interface.name) == 0) probe->layerShell = true;
+    else if (std::strcmp(interface, wp_viewporter_interface.name) == 0) probe->viewporter = true;
+    else if (std::strcmp(interface, wl_subcompositor_interface.name) == 0) probe->subcompositor = true;
+}
+
+void probeGlobalRemove(void*, wl_registry*, uint32_t)
+{
+}
+
+const wl_registry_listener probeListener = { probeGlobal, probeGlobalRemove };
+
+// Only the name is needed to match outputs with QScreens, Qt tracks the rest
+void outputGeometry(void*, wl_output*, int32_t, int32_t, int32_t, int32_t, int32_t, const char*, const char*, int32_t)
+{
+}
+
+void outputMode(void*, wl_output*, uint32_t, int32_t, int32_t, int32_t)
+{
+}
+
+void outputDone(void*, wl_output*)
+{
+}
+
+void outputScale(void*, wl_output*, int32_t)
+{
+}
+
+void outputDescription(void*, wl_output*, const char*)
+{
+}
+
+const int ArmCount = CrosshairGeometry::ArmCount;
+
+}
+
+WaylandCrosshairRenderer::WaylandCrosshairRenderer()
+    : m_notifier(nullptr)
+    , m_display(nullptr)
+    , m_registry(nullptr)
+    , m_compositor(nullptr)
+    , m_subcompositor(nullptr)
+    , m_shm(nullptr)
+    , m_layerShell(nullptr)
+    , m_viewporter(nullptr)
+    , m_surface(nullptr)
+    , m_layerSurface(nullptr)
+    , m_viewport(nullptr)
+    , m_backgroundPool(nullptr)
+    , m_backgroundBuffer(nullptr)
+    , m_configured(false)
+{
+}
+
+WaylandCrosshairRenderer::~WaylandCrosshairRenderer()
+{
+    cleanup();
+}
+
+bool WaylandCrosshairRenderer::isSupported()
+{
+    // Probe once on a throwaway connection; compositors without layer-shell
+    // (e.g. GNOME) keep using the Qt widget overlay
+    static int supported = -1;
+    if (supported >= 0) return supported == 1;
+
+    supported = 0;
+    if (qEnvironmentVariableIsEmpty("WAYLAND_DISPLAY")) return false;
+
+    wl_display* display = wl_display_connect(nullptr);
+    if (!display) return false;
+
+    GlobalProbe probe;
+    wl_registry* registry = wl_display_get_registry(display);
+    wl_registry_add_listener(registry, &probeListener, &probe);
+    wl_display_roundtrip(display);
+    wl_registry_destroy(registry);
+    wl_display_disconnect(display);
+
+    supported = (probe.layerShell && probe.viewporter && probe.subcompositor) ? 1 : 0;
+    return supported == 1;
+}
+
+bool WaylandCrosshairRenderer::initialize()
+{
+    m_display = wl_display_connect(nullptr);
+    if (!m_display) {
+        qWarning() << "Failed to connect to the Wayland display";
+        return false;
+    }
+
+    static const wl_registry_listener registryListener = { handleGlobal, handleGlobalRemove };
+    m_registry = wl_display_get_registry(m_display);
+    wl_registry_add_listener(m_registry, &registryListener, this);
+    wl_display_roundtrip(m_display);
+    // Second round trip for the output names sent in reply to the binds
+    wl_display_roundtrip(m_display);
+
+    if (!m_compositor || !m_subcompositor || !m_shm || !m_layerShell || !m_viewporter) {
+        qWarning() << "Wayland compositor lacks layer-shell, viewporter or subsurface support";
+        return false;
+    }
+
+    m_notifier = new QSocketNotifier(wl_display_get_fd(m_display), QSocketNotifier::Read, this);
+    connect(m_notifier, &QSocketNotifier::activated, this, &WaylandCrosshairRenderer::dispatchEvents);
+
+    return true;
+}
+
+void WaylandCrosshairRenderer::cleanup()
+{
+    stopRendering();
+
+    if (m_notifier) {
+        delete m_notifier;
+        m_notifier = nullptr;
+    }
+
+    if (!m_display) return;
+
+    for (const Output& output : m_outputs) {
+        wl_output_destroy(output.output);
+    }
+    m_outputs.clear();
+    if (m_viewporter) wp_viewporter_destroy(m_viewporter);
+    if (m_layerShell) zwlr_layer_shell_v1_destroy(m_layerShell);
+    if (m_shm) wl_shm_destroy(m_shm);
+    if (m_subcompositor) wl_subcompositor_destroy(m_subcompositor);
+    if (m_compositor) wl_compositor_destroy(m_compositor);
+    if (m_registry) wl_registry_destroy(m_registry);
+    m_viewporter = nullptr;
+    m_layerShell = nullptr;
+    m_shm = nullptr;
+    m_subcompositor = nullptr;
+    m_compositor = nullptr;
+    m_registry = nullptr;
+
+    wl_display_disconnect(m_display);
+    m_display = nullptr;
+}
+
+void WaylandCrosshairRenderer::startRendering()
+{
+    if (m_isRendering || !m_display) return;
+
+    m_mousePos = QCursor::pos();
+    QScreen *screen = QApplication::screenAt(m_mousePos);
+    if (!screen) screen = QApplication::primaryScreen();
+    if (!createSurfaces(screen)) {
+        destroySurfaces();
+        return;
+    }
+
+    m_isRendering = true;
+    renderFrame();
+}
+
+void WaylandCrosshairRenderer::stopRendering()
+{
+    if (!m_isRendering) return;
+
+    destroySurfaces();
+    flush();
+    m_isRendering = false;
+}
+
+void WaylandCrosshairRenderer::updateSettings(const Settings& settings)
+{
+    m_settings = settings;
+
+    // Arm pixels depend on every setting, rasterize them again on the next frame
+    for (ArmSurface& arm : m_arms) {
+        arm.totalDistance = -1;
+    }
+
+    if (m_isRendering) {
+        renderFrame();
+    }
+}
+
+void WaylandCrosshairRenderer::updateMousePosition(const QPoint& pos)
+{
+    m_mousePos = pos;
+    if (!m_isRendering) return;
+
+    // A layer surface covers a single output, follow the cursor to the next one
+    QScreen *screen = QApplication::screenAt(pos);
+    if (screen && screen->name() != m_screenName) {
+        destroySurfaces();
+        if (!createSurfaces(screen)) {
+            destroySurfaces();
+            m_isRendering = false;
+            return;
+        }
+    }
+    renderFrame();
+}
+
+void WaylandCrosshairRenderer::syncDisplay()
+{
+    // The overlay has its own connection, Qt's is not involved
+    if (m_display) {
+        wl_display_roundtrip(m_display);
+    }
+}
+
+bool WaylandCrosshairRenderer::isConnected() const
+{
+    return m_display && wl_display_get_error(m_display) == 0;
+}
+
+void WaylandCrosshairRenderer::dispatchEvents()
+{
+    if (wl_display_dispatch(m_display) < 0) {
+        qWarning() << "Lost connection to the Wayland compositor";
+        m_notifier->setEnabled(false);
+    }
+}
+
+void WaylandCrosshairRenderer::flush()
+{
+    if (m_display) {
+        wl_display_flush(m_display);
+    }
+}
+
+bool WaylandCrosshairRenderer::createSurfaces(QScreen* screen)
+{
+    m_configured = false;
+    m_screenName = screen->name();
+    m_screenOrigin = screen->geometry().topLeft();
+
+    // Without a matching output (wl_output older than version 4) the compositor picks one
+    wl_output* output = nullptr;
+    for (const Output& candidate : m_outputs) {
+        if (candidate.name == m_screenName) output = candidate.output;
+    }
+
+    wl_region* emptyRegion = wl_compositor_create_region(m_compositor);
+
+    m_surface = wl_compositor_create_surface(m_compositor);
+    wl_surface_set_input_region(m_surface, emptyRegion);
+
+    static const zwlr_layer_surface_v1_listener layerSurfaceListener = { handleConfigure, handleClosed };
+    m_layerSurface = zwlr_layer_shell_v1_get_layer_surface(m_layerShell, m_surface, output,
+                                                          ZWLR_LAYER_SHELL_V1_LAYER_OVERLAY, "mousecross");
+    zwlr_layer_surface_v1_add_listener(m_layerSurface, &layerSurfaceListener, this);
+    zwlr_layer_surface_v1_set_anchor(m_layerSurface,
+                                     ZWLR_LAYER_SURFACE_V1_ANCHOR_TOP | ZWLR_LAYER_SURFACE_V1_ANCHOR_BOTTOM |
+                                     ZWLR_LAYER_SURFACE_V1_ANCHOR_LEFT | ZWLR_LAYER_SURFACE_V1_ANCHOR_RIGHT);
+    zwlr_layer_surface_v1_set_exclusive_zone(m_layerSurface, -1);
+    zwlr_layer_surface_v1_set_keyboard_interactivity(m_layerSurface, 0);
+    zwlr_layer_surface_v1_set_size(m_layerSurface, 0, 0);
+
+    // The parent only carries a 1x1 transparent buffer stretched over the output
+    m_viewport = wp_viewporter_get_viewport(m_viewporter, m_surface);
+
+    for (ArmSurface& arm : m_arms) {
+        arm.surface = wl_compositor_create_surface(m_compositor);
+        wl_surface_set_input_region(arm.surface, emptyRegion);
+        arm.subsurface = wl_subcompositor_get_subsurface(m_subcompositor, arm.surface, m_surface);
+        arm.totalDistance = -1;
+    }
+    wl_region_destroy(emptyRegion);
+
+    // Initial commit without a buffer, then wait for the first configure
+    wl_surface_commit(m_surface);
+    while (!m_configured && m_layerSurface) {
+        if (wl_display_roundtrip(m_display) < 0) return false;
+    }
+    return m_configured;
+}
+
+void WaylandCrosshairRenderer::destroySurfaces()
+{
+    for (ArmSurface& arm : m_arms) {
+        releasePool(arm);
+        if (arm.subsurface) wl_subsurface_destroy(arm.subsurface);
+        if (arm.surface) wl_surface_destroy(arm.surface);
+        arm.subsurface = nullptr;
+        arm.surface = nullptr;
+        arm.totalDistance = -1;
+    }
+
+    if (m_viewport) wp_viewport_destroy(m_viewport);
+    if (m_layerSurface) zwlr_layer_surface_v1_destroy(m_layerSurface);
+    if (m_surface) wl_surface_destroy(m_surface);
+    if (m_backgroundBuffer) wl_buffer_destroy(m_backgroundBuffer);
+    if (m_backgroundPool) wl_shm_pool_destroy(m_backgroundPool);
+    m_viewport = nullptr;
+    m_layerSurface = nullptr;
+    m_surface = nullptr;
+    m_backgroundBuffer = nullptr;
+    m_backgroundPool = nullptr;
+    m_configured = false;
+}
+
+bool WaylandCrosshairRenderer::ensurePool(ArmSurface& arm, size_t slotBytes)
+{
+    if (arm.pool && arm.slotBytes >= slotBytes) return true;
+
+    releasePool(arm);
+
+    // Leave headroom so small growth does not reallocate the pool every frame
+    slotBytes += slotBytes / 2;
+    size_t poolBytes = slotBytes * 2;
+    int fd = createShmFile(poolBytes);
+    if (fd < 0) return false;
+
+    void* memory = mmap(nullptr, poolBytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (memory == MAP_FAILED) {
+        close(fd);
+        return false;
+    }
+
+    arm.pool = wl_shm_create_pool(m_shm, fd, static_cast<int32_t>(poolBytes));
+    close(fd);
+
+    arm.memory = static_cast<uchar*>(memory);
+    arm.slotBytes = slotBytes;
+    for (int i = 0; i < 2; ++i) {
+        arm.slots[i].data = arm.memory + i * slotBytes;
+        arm.slots[i].busy = false;
+    }
+    return true;
+}
+
+void WaylandCrosshairRenderer::releasePool(ArmSurface& arm)
+{
+    for (BufferSlot& slot : arm.slots) {
+        if (slot.buffer) wl_buffer_destroy(slot.buffer);
+        slot.buffer = nullptr;
+        slot.data = nullptr;
+        slot.busy = false;
+    }
+    if (arm.pool) wl_shm_pool_destroy(arm.pool);
+    if (arm.memory) munmap(arm.memory, arm.slotBytes * 2);
+    arm.pool = nullptr;
+    arm.memory = nullptr;
+    arm.slotBytes = 0;
+}
+
+void WaylandCrosshairRenderer::renderFrame()
+{
+    if (!m_configured || !m_surface) return;
+
+    QElapsedTimer frameTimer;
+    frameTimer.start();
+
+    QScreen *screen = QApplication::screenAt(m_mousePos);
+    if (!screen) screen = QApplication::primaryScreen();
+    const int baseThickness = qMax(3, static_cast<int>(m_settings.lineWidth * screen->devicePixelRatio()));
+
+    // Subsurface positions are relative to the output the layer surface is on
+    CrosshairGeometry geometry(m_settings, m_mousePos - m_screenOrigin, m_screenGeometry, baseThickness);
+
+    for (int i = 0; i < ArmCount; ++i) {
+        ArmSurface& arm = m_arms[i];
+        const auto armId = static_cast<CrosshairGeometry::Arm>(i);
+        const CrosshairGeometry::ArmGeometry& armGeometry = geometry.arm(armId);
+        const QPoint start = armGeometry.start.toPoint();
+
+        // Same length means same pixels, only the subsurface position changes
+        if (armGeometry.totalDistance != arm.totalDistance) {
+            QRect bounds = geometry.armBounds(armId).toAlignedRect();
+            BufferSlot* slot = nullptr;
+            if (!bounds.isEmpty() && ensurePool(arm, size_t(bounds.width()) * bounds.height() * 4)) {
+                for (BufferSlot& candidate : arm.slots) {
+                    if (!candidate.busy) {
+                        slot = &candidate;
+                        break;
+                    }
+                }
+            }
+
+            // Both buffers still held by the compositor, retry on the next frame
+            if (slot) {
+                const int stride = bounds.width() * 4;
+                if (slot->buffer) wl_buffer_destroy(slot->buffer);
+                slot->buffer = wl_shm_pool_create_buffer(arm.pool, static_cast<int32_t>(slot->data - arm.memory),
+                                                         bounds.width(), bounds.height(), stride,
+                                                         WL_SHM_FORMAT_ARGB8888);
+                static const wl_buffer_listener bufferListener = { handleBufferRelease };
+                wl_buffer_add_listener(slot->buffer, &bufferListener, slot);
+
+                QImage image(slot->data, bounds.width(), bounds.height(), stride, QImage::Format_ARGB32_Premultiplied);
+                image.fill(Qt::transparent);
+                {
+                    QPainter painter(&image);
+                    painter.setRenderHint(QPainter::Antialiasing, m_settings.antialiasing);
+                    painter.translate(-bounds.topLeft());
+                    geometry.paintArm(painter, armId, m_settings);
+
+                    // Apply the overall opacity once so overlapping parts do not blend with each other
+                    painter.resetTransform();
+                    painter.setCompositionMode(QPainter::CompositionMode_DestinationIn);
+                    painter.fillRect(image.rect(), QColor(0, 0, 0, qRound(m_settings.opacity * 255)));
+                }
+
+                wl_surface_attach(arm.surface, slot->buffer, 0, 0);
+                wl_surface_damage_buffer(arm.surface, 0, 0, bounds.width(), bounds.height());
+                wl_surface_commit(arm.surface);
+                slot->busy = true;
+
+                arm.offset = bounds.topLeft() - start;
+                arm.totalDistance = armGeometry.totalDistance;
+            }
+        }
+
+        wl_subsurface_set_position(arm.subsurface, start.x() + arm.offset.x(), start.y() + arm.offset.y());
+    }
+
+    // Subsurfaces are synchronized, their buffers and positions apply atomically here
+    wl_surface_commit(m_surface);
+    flush();
+    m_lastFrameTime = frameTimer.nsecsElapsed();
+    notifyFramePresented();
+}
+
+void WaylandCrosshairRenderer::handleGlobal(void* data, wl_registry* registry, uint32_t name,
+                                            const char* interface, uint32_t version)
+{
+    auto* self = static_cast<WaylandCrosshairRenderer*>(data);
+
+    if (std::strcmp(interface, wl_compositor_interface.name) == 0) {
+        self->m_compositor = static_cast<wl_compositor*>(
+            wl_registry_bind(registry, name, &wl_compositor_interface, qMin(version, 4u)));
+    } else if (std::strcmp(interface, wl_subcompositor_interface.name) == 0) {
+        self->m_subcompositor = static_cast<wl_subcompositor*>(
+            wl_registry_bind(registry, name, &wl_subcompositor_interface, 1));
+    } else if (std::strcmp(interface, wl_shm_interface.name) == 0) {
+        self->m_shm = static_cast<wl_shm*>(wl_registry_bind(registry, name, &wl_shm_interface, 1));
+    } else if (std::strcmp(interface, zwlr_layer_shell_v1_interface.name) == 0) {
+        self->m_layerShell = static_cast<zwlr_layer_shell_v1*>(
+            wl_registry_bind(registry, name, &zwlr_layer_shell_v1_interface, qMin(version, 3u)));
+    } else if (std::strcmp(interface, wp_viewporter_interface.name) == 0) {
+        self->m_viewporter = static_cast<wp_viewporter*>(
+            wl_registry_bind(registry, name, &wp_viewporter_interface, 1));
+    } else if (std::strcmp(interface, wl_output_interface.name) == 0) {
+        static const wl_output_listener outputListener = {
+            outputGeometry, outputMode, outputDone, outputScale, handleOutputName, outputDescription
+        };
+        Output output;
+        output.global = name;
+        output.output = static_cast<wl_output*>(wl_registry_bind(registry, name, &wl_output_interface, qMin(version, 4u)));
+        wl_output_add_listener(output.output, &outputListener, self);
+        self->m_outputs.append(output);
+    }
+}
+
+void WaylandCrosshairRenderer::handleOutputName(void* data, wl_output* output, const char* name)
+{
+    auto* self = static_cast<WaylandCrosshairRenderer*>(data);
+    for (Output& candidate : self->m_outputs) {
+        if (candidate.output == output) candidate.name = QString::fromUtf8(name);
+    }
+}
+
+void WaylandCrosshairRenderer::handleGlobalRemove(void* data, wl_registry* registry, uint32_t name)
+{
+    Q_UNUSED(registry);
+    auto* self = static_cast<WaylandCrosshairRenderer*>(data);
+
+    // An unplugged output also closes a layer surface on it, see handleClosed()
+    for (int i = 0; i < self->m_outputs.size(); ++i) {
+        if (self->m_outputs[i].global == name) {
+            wl_output_destroy(self->m_outputs[i].output);
+            self->m_outputs.removeAt(i);
+            break;
+        }
+    }
+}
+
+void WaylandCrosshairRenderer::handleConfigure(void* data, zwlr_layer_surface_v1* surface, uint32_t serial,
+                                               uint32_t width, uint32_t height)
+{
+    auto* self = static_cast<WaylandCrosshairRenderer*>(data);
+    zwlr_layer_surface_v1_ack_configure(surface, serial);
+
+    if (width == 0 || height == 0) return;
+    self->m_screenGeometry = QRect(0, 0, static_cast<int>(width), static_cast<int>(height));
+    wp_viewport_set_destination(self->m_viewport, static_cast<int32_t>(width), static_cast<int32_t>(height));
+
+    if (!self->m_backgroundBuffer) {
+        int fd = createShmFile(4);
+        if (fd < 0) return;
+        self->m_backgroundPool = wl_shm_create_pool(self->m_shm, fd, 4);
+        self->m_backgroundBuffer = wl_shm_pool_create_buffer(self->m_backgroundPool, 0, 1, 1, 4,
+                                                             WL_SHM_FORMAT_ARGB8888);
+        close(fd);
+        wl_surface_attach(self->m_surface, self->m_backgroundBuffer, 0, 0);
+    }
+
+    wl_surface_commit(self->m_surface);
+    self->m_configured = true;
+}
+
+void WaylandCrosshairRenderer::handleClosed(void* data, zwlr_layer_surface_v1* surface)
+{
+    Q_UNUSED(surface);
+    auto* self = static_cast<WaylandCrosshairRenderer*>(data);
+
+    // The compositor removed our surface (output unplugged), recreate it on the next start
+    QMetaObject::invokeMethod(self, [self]() { self->stopRendering(); }, Qt::QueuedConnection);
+}
+
+void WaylandCrosshairRenderer::handleBufferRelease(void* data, wl_buffer* buffer)
+{
+    Q_UNUSED(buffer);
+    static_cast<BufferSlot*>(data)->busy = false;
+}
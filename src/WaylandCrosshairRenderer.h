@@ -0,0 +1,143 @@
+/*
+ * MouseCross - A crosshair overlay application for visually impaired users
+ * Copyright (C) 2025 Stefan Lohmaier <stefan@slohmaier.de>
+ *
+ * This file is part of MouseCross.
+ *
+ * MouseCross is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MouseCross is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with MouseCross. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Project website: https://slohmaier.de/mousecross
+ */
+
+#ifndef WAYLANDCROSSHAIRRENDERER_H
+#define WAYLANDCROSSHAIRRENDERER_H
+
+#include "CrosshairRenderer.h"
+#include <QObject>
+#include <QPoint>
+#include <QString>
+#include <QVector>
+
+class QSocketNotifier;
+class QScreen;
+struct wl_display;
+struct wl_registry;
+struct wl_output;
+struct wl_compositor;
+struct wl_subcompositor;
+struct wl_shm;
+struct wl_shm_pool;
+struct wl_buffer;
+struct wl_surface;
+struct wl_subsurface;
+struct zwlr_layer_shell_v1;
+struct zwlr_layer_surface_v1;
+struct wp_viewporter;
+struct wp_viewport;
+
+// Native Wayland renderer built on wlr-layer-shell. A transparent overlay-layer
+// surface with an empty input region hosts one subsurface per arm. Each arm is
+// rasterized into a small wl_shm buffer; moves that keep an arm's length only
+// reposition its subsurface, so most cursor moves upload no new pixels.
+// The layer surface covers the output the cursor is on and moves with it.
+class WaylandCrosshairRenderer : public QObject, public CrosshairRenderer
+{
+    Q_OBJECT
+
+public:
+    WaylandCrosshairRenderer();
+    ~WaylandCrosshairRenderer() override;
+
+    static bool isSupported();
+
+    bool initialize() override;
+    void cleanup() override;
+
+    void startRendering() override;
+    void stopRendering() override;
+
+    void updateSettings(const Settings& settings) override;
+    void updateMousePosition(const QPoint& pos) override;
+
+    bool isRendering() const override { return m_isRendering; }
+    void syncDisplay() override;
+
+    // False once the compositor closed the connection or sent a protocol error
+    bool isConnected() const;
+
+private slots:
+    void dispatchEvents();
+
+private:
+    struct BufferSlot {
+        wl_buffer* buffer = nullptr;
+        uchar* data = nullptr;
+        bool busy = false;
+    };
+
+    struct ArmSurface {
+        wl_surface* surface = nullptr;
+        wl_subsurface* subsurface = nullptr;
+        wl_shm_pool* pool = nullptr;
+        uchar* memory = nullptr;
+        size_t slotBytes = 0;
+        BufferSlot slots[2];
+        int totalDistance = -1;   // Length the current pixels were rasterized for
+        QPoint offset;            // Buffer origin relative to the arm start
+    };
+
+    struct Output {
+        wl_output* output = nullptr;
+        uint32_t global = 0;
+        QString name;             // Connector name, matches QScreen::name()
+    };
+
+    bool createSurfaces(QScreen* screen);
+    void destroySurfaces();
+    bool ensurePool(ArmSurface& arm, size_t slotBytes);
+    void releasePool(ArmSurface& arm);
+    void renderFrame();
+    void flush();
+
+    static void handleGlobal(void* data, wl_registry* registry, uint32_t name, const char* interface, uint32_t version);
+    static void handleGlobalRemove(void* data, wl_registry* registry, uint32_t name);
+    static void handleConfigure(void* data, zwlr_layer_surface_v1* surface, uint32_t serial, uint32_t width, uint32_t height);
+    static void handleClosed(void* data, zwlr_layer_surface_v1* surface);
+    static void handleBufferRelease(void* data, wl_buffer* buffer);
+    static void handleOutputName(void* data, wl_output* output, const char* name);
+
+    QSocketNotifier* m_notifier;
+
+    wl_display* m_display;
+    wl_registry* m_registry;
+    wl_compositor* m_compositor;
+    wl_subcompositor* m_subcompositor;
+    wl_shm* m_shm;
+    zwlr_layer_shell_v1* m_layerShell;
+    wp_viewporter* m_viewporter;
+
+    wl_surface* m_surface;
+    zwlr_layer_surface_v1* m_layerSurface;
+    wp_viewport* m_viewport;
+    wl_shm_pool* m_backgroundPool;
+    wl_buffer* m_backgroundBuffer;
+    bool m_configured;
+    QVector<Output> m_outputs;
+    QString m_screenName;       // Screen the layer surface was created on
+    QPoint m_screenOrigin;      // Its top left corner in global coordinates
+
+    ArmSurface m_arms[4];
+};
+
+#endif // WAYLANDCROSSHAIRRENDERER_H
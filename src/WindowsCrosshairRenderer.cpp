@@ -21,10 +21,13 @@
  */
 
 #include "WindowsCrosshairRenderer.h"
+#include "CrosshairGeometry.h"
+#include "RenderPrewarmer.h"
 #include <QPainter>
 #include <QApplication>
 #include <QScreen>
 #include <QCursor>
+#include <QElapsedTimer>
 #include <cmath>
 #include <vector>
 
@@ -32,9 +35,22 @@
 #include <windows.h>
 #endif
 
+namespace {
+
+// Prewarmed pens and shapes are in the main colour of the settings they were built for
+const PrewarmedState::Screen* prewarmedScreen(const std::shared_ptr<const PrewarmedState>& state,
+                                              const CrosshairRenderer::Settings& settings,
+                                              const QColor& color, const QPoint& pos)
+{
+    if (!state || state->settings != settings || color != settings.color) return nullptr;
+    return state->screenAt(pos);
+}
+
+}
+
 WindowsCrosshairRenderer::WindowsCrosshairRenderer()
     : QWidget(nullptr)
-    , m_updateTimer(nullptr)
+    , m_parked(false)
 {
 }
 
@@ -47,20 +63,12 @@ bool WindowsCrosshairRenderer::initialize()
 {
     setupWindow();
     
-    m_updateTimer = new QTimer(this);
-    connect(m_updateTimer, &QTimer::timeout, this, &WindowsCrosshairRenderer::updateCrosshair);
-    
     return true;
 }
 
 void WindowsCrosshairRenderer::cleanup()
 {
     stopRendering();
-    
-    if (m_updateTimer) {
-        delete m_updateTimer;
-        m_updateTimer = nullptr;
-    }
 }
 
 void WindowsCrosshairRenderer::setupWindow()
@@ -93,68 +101,109 @@ void WindowsCrosshairRenderer::startRendering()
 {
     if (m_isRendering) return;
     
-    show();
-    raise();
-    
-    if (m_updateTimer) {
-        m_updateTimer->start(16); // ~60 FPS
+    // A parked overlay is still mapped, drawing the crosshair is all that is left
+    if (!m_parked) {
+        show();
+        raise();
     }
     
+    m_parked = false;
     m_isRendering = true;
-    updateCrosshair();
+    updateMousePosition(QCursor::pos());
 }
 
 void WindowsCrosshairRenderer::stopRendering()
 {
-    if (!m_isRendering) return;
-    
-    if (m_updateTimer) {
-        m_updateTimer->stop();
-    }
+    if (!m_isRendering && !m_parked) return;
     
     hide();
+    m_lastDamage = QRegion();
+    m_isRendering = false;
+    m_parked = false;
+}
+
+void WindowsCrosshairRenderer::parkRendering()
+{
+    if (!m_isRendering) return;
+    
+    // Clear only the bands the crosshairs covered, paintEvent() draws nothing while parked
     m_isRendering = false;
+    m_parked = true;
+    update(m_lastDamage);
+    m_lastDamage = QRegion();
 }
 
 void WindowsCrosshairRenderer::updateSettings(const Settings& settings)
 {
     m_settings = settings;
-    setWindowOpacity(settings.opacity);
-    update();
+    if (!qFuzzyCompare(windowOpacity(), settings.opacity)) {
+        setWindowOpacity(settings.opacity);
+    }
+    
+    // Profile switches change settings on focus changes, repaint only the old and new bands
+    const QRegion damage = crosshairRegion();
+    update(m_lastDamage.united(damage));
+    m_lastDamage = damage;
 }
 
 void WindowsCrosshairRenderer::updateMousePosition(const QPoint& pos)
 {
     m_mousePos = pos;
-    update();
+    
+    // Repaint only the bands the crosshairs leave and enter, all pointers in one pass
+    const QRegion damage = crosshairRegion();
+    update(m_lastDamage.united(damage));
+    m_lastDamage = damage;
 }
 
-void WindowsCrosshairRenderer::updateCrosshair()
+QRegion WindowsCrosshairRenderer::crosshairRegion() const
 {
-    QPoint newPos = QCursor::pos();
-    if (newPos != m_mousePos) {
-        updateMousePosition(newPos);
+    const int baseThickness = getScaledLineWidth();
+    QRegion region;
+    auto addPointer = [&](const QPoint& pos) {
+        CrosshairGeometry geometry(m_settings, pos, m_screenGeometry, baseThickness);
+        region += geometry.horizontalBand();
+        region += geometry.verticalBand();
+    };
+    addPointer(m_mousePos);
+    for (const QPoint& pos : m_extraPointers) {
+        addPointer(pos);
     }
+    return region;
 }
 
 void WindowsCrosshairRenderer::paintEvent(QPaintEvent *event)
 {
     Q_UNUSED(event);
     
+    // Qt cleared the damaged region already, which is all a parked overlay needs
+    if (!m_isRendering) return;
+    
+    QElapsedTimer frameTimer;
+    frameTimer.start();
+    
+    // Qt clips to the damaged region, see updateMousePosition()
     QPainter painter(this);
-    painter.setRenderHint(QPainter::Antialiasing);
+    painter.setRenderHint(QPainter::Antialiasing, m_settings.antialiasing);
     
     if (m_settings.inverted) {
         painter.setCompositionMode(QPainter::CompositionMode_Difference);
     }
     
-    drawCrosshair(painter);
+    // Extra pointers first so the main crosshair stays on top where they cross
+    for (int i = 0; i < m_extraPointers.size(); ++i) {
+        drawCrosshair(painter, m_extraPointers[i], pointerColor(i + 1));
+    }
+    drawCrosshair(painter, m_mousePos, pointerColor(0));
+    painter.end();
+    m_lastFrameTime = frameTimer.nsecsElapsed();
+    notifyFramePresented();
 }
 
-void WindowsCrosshairRenderer::drawCrosshair(QPainter &painter)
+void WindowsCrosshairRenderer::drawCrosshair(QPainter &painter, const QPoint& pos, const QColor& color)
 {
-    int x = m_mousePos.x();
-    int y = m_mousePos.y();
+    int x = pos.x();
+    int y = pos.y();
     
     int distToLeft = x - m_screenGeometry.left();
     int distToRight = m_screenGeometry.right() - x;
@@ -163,7 +212,7 @@ void WindowsCrosshairRenderer::drawCrosshair(QPainter &painter)
     
     // Draw closing lines at the start of each crosshair arm (at offset positions)
     int baseThickness = getScaledLineWidth();
-    QPen closingPen(m_settings.color);
+    QPen closingPen(color);
     closingPen.setWidth(baseThickness);
     closingPen.setCapStyle(Qt::FlatCap);
     painter.setPen(closingPen);
@@ -186,13 +235,13 @@ void WindowsCrosshairRenderer::drawCrosshair(QPainter &painter)
     painter.drawLine(x - closingLineLength/2, y + m_settings.offsetFromCursor, 
                      x + closingLineLength/2, y + m_settings.offsetFromCursor);
     
-    drawGradientLine(painter, x - m_settings.offsetFromCursor, y, m_screenGeometry.left(), y, distToLeft);
-    drawGradientLine(painter, x + m_settings.offsetFromCursor, y, m_screenGeometry.right(), y, distToRight);
-    drawGradientLine(painter, x, y - m_settings.offsetFromCursor, x, m_screenGeometry.top(), distToTop);
-    drawGradientLine(painter, x, y + m_settings.offsetFromCursor, x, m_screenGeometry.bottom(), distToBottom);
+    drawGradientLine(painter, x - m_settings.offsetFromCursor, y, m_screenGeometry.left(), y, distToLeft, color);
+    drawGradientLine(painter, x + m_settings.offsetFromCursor, y, m_screenGeometry.right(), y, distToRight, color);
+    drawGradientLine(painter, x, y - m_settings.offsetFromCursor, x, m_screenGeometry.top(), distToTop, color);
+    drawGradientLine(painter, x, y + m_settings.offsetFromCursor, x, m_screenGeometry.bottom(), distToBottom, color);
     
     // Draw thin center lines in each crosshair arm with main color
-    QPen centerPen(m_settings.color);
+    QPen centerPen(color);
     centerPen.setWidth(1);
     centerPen.setCapStyle(Qt::FlatCap);
     painter.setPen(centerPen);
@@ -207,9 +256,23 @@ void WindowsCrosshairRenderer::drawCrosshair(QPainter &painter)
     painter.drawLine(x, y + m_settings.offsetFromCursor, x, m_screenGeometry.bottom());
 }
 
-void WindowsCrosshairRenderer::drawGradientLine(QPainter &painter, int startX, int startY, int endX, int endY, int totalDistance)
+void WindowsCrosshairRenderer::drawGradientLine(QPainter &painter, int startX, int startY, int endX, int endY, int totalDistance, const QColor& color)
 {
-    const int segments = 50;
+    if (m_settings.solidArms) {
+        // One flat stroke, uniform pixels compress well on remote sessions
+        QPen pen(color);
+        pen.setWidth(getScaledLineWidth());
+        pen.setCapStyle(Qt::FlatCap);
+        painter.setPen(pen);
+        painter.drawLine(startX, startY, endX, endY);
+        if (m_settings.showArrows) {
+            drawDirectionShapes(painter, startX, startY, endX, endY, totalDistance, color);
+        }
+        return;
+    }
+    
+    const int segments = qMax(1, m_settings.taperSegments);
+    const PrewarmedState::Screen* prewarmed = prewarmedScreen(m_prewarmed, m_settings, color, m_mousePos);
     
     for (int i = 0; i < segments; ++i) {
         double progress = static_cast<double>(i) / segments;
@@ -224,8 +287,18 @@ void WindowsCrosshairRenderer::drawGradientLine(QPainter &painter, int startX, i
         int segEndX = startX + static_cast<int>((endX - startX) * nextProgress);
         int segEndY = startY + static_cast<int>((endY - startY) * nextProgress);
         
+        if (prewarmed) {
+            painter.setPen(prewarmed->taperPens[i]);
+            painter.drawLine(segStartX, segStartY, segEndX, segEndY);
+            if (!m_settings.inverted) {
+                painter.setPen(prewarmed->contrastPens[i]);
+                painter.drawLine(segStartX, segStartY, segEndX, segEndY);
+            }
+            continue;
+        }
+        
         // Draw outer line with selected color
-        QPen outerPen(m_settings.color);
+        QPen outerPen(color);
         outerPen.setWidth(currentThickness);
         outerPen.setCapStyle(Qt::FlatCap);
         painter.setPen(outerPen);
@@ -235,7 +308,7 @@ void WindowsCrosshairRenderer::drawGradientLine(QPainter &painter, int startX, i
         if (!m_settings.inverted) {
             QColor inverseColor;
             int r, g, b;
-            m_settings.color.getRgb(&r, &g, &b);
+            color.getRgb(&r, &g, &b);
             inverseColor.setRgb(255 - r, 255 - g, 255 - b);
             
             QPen innerPen(inverseColor);
@@ -247,11 +320,11 @@ void WindowsCrosshairRenderer::drawGradientLine(QPainter &painter, int startX, i
     }
     
     if (m_settings.showArrows) {
-        drawDirectionShapes(painter, startX, startY, endX, endY, totalDistance);
+        drawDirectionShapes(painter, startX, startY, endX, endY, totalDistance, color);
     }
 }
 
-void WindowsCrosshairRenderer::drawDirectionShapes(QPainter &painter, int startX, int startY, int endX, int endY, int totalDistance)
+void WindowsCrosshairRenderer::drawDirectionShapes(QPainter &painter, int startX, int startY, int endX, int endY, int totalDistance, const QColor& color)
 {
     double deltaX = startX - endX;
     double deltaY = startY - endY;
@@ -259,40 +332,22 @@ void WindowsCrosshairRenderer::drawDirectionShapes(QPainter &painter, int startX
     
     if (length == 0) return;
     
-    painter.setBrush(QBrush(m_settings.color));
+    painter.setBrush(QBrush(color));
     painter.setPen(Qt::NoPen);
     
     // Get actual screen bounds for clipping  
     QRect screenBounds = QApplication::primaryScreen()->geometry();
     
     // Generate circle positions with fixed diameter-based spacing
-    std::vector<double> circlePositions;
     int baseThickness = getScaledLineWidth();
+    std::vector<double> circlePositions = CrosshairGeometry::shapeDistances(m_settings, baseThickness, totalDistance);
     
-    // Calculate initial circle diameter at center (smallest size)
-    // Circle radius = currentThickness / 4, so diameter = currentThickness / 2
-    double baseDiameter = baseThickness / 2.0;       // Base circle diameter
-    double initialSpacing = baseDiameter * 2.0;      // Start with 2x circle diameter (half of 4x)
-    double spacingMultiplier = 1.0 + (m_settings.circleSpacingIncrease / 100.0);  // Convert percentage to multiplier
-    
-    double currentDistance = initialSpacing;         // First circle position
-    double currentSpacing = initialSpacing;
-    
-    // Generate positions from center toward edge with fixed progressive spacing
-    while (currentDistance < totalDistance * 1.2) {  // Go slightly beyond line end for edge cases
-        circlePositions.push_back(currentDistance);
-        
-        // Calculate circle diameter at this position for next spacing
-        double progress = currentDistance / totalDistance;
-        double thickMultiplier = 1.0 + (m_settings.thicknessMultiplier - 1.0) * progress;
-        double currentThickness = baseThickness * thickMultiplier;
-        double circleDiameter = currentThickness / 2.0;  // Circle diameter = thickness / 2
-        
-        // Next spacing is 2x the current circle diameter, increased by setting percentage
-        currentSpacing = (circleDiameter * 2.0) * spacingMultiplier;
-        spacingMultiplier *= (1.0 + (m_settings.circleSpacingIncrease / 100.0));  // Compound the percentage increase
-        currentDistance += currentSpacing;
-    }
+    // Shapes rasterized by the prewarm are blitted instead of filled
+    const PrewarmedState::Screen* prewarmed = prewarmedScreen(m_prewarmed, m_settings, color, m_mousePos);
+    const CrosshairGeometry::Arm arm = deltaX > 0 ? CrosshairGeometry::LeftArm
+                                     : deltaX < 0 ? CrosshairGeometry::RightArm
+                                     : deltaY > 0 ? CrosshairGeometry::TopArm
+                                                  : CrosshairGeometry::BottomArm;
     
     // Draw circles from center outward
     for (double dist : circlePositions) {
@@ -321,6 +376,15 @@ void WindowsCrosshairRenderer::drawDirectionShapes(QPainter &painter, int startX
             // Set clipping region for partial shapes
             painter.setClipRect(screenBounds);
             
+            const PrewarmedState::ShapeImage* image = prewarmed
+                ? m_prewarmed->shapeImage(prewarmed->devicePixelRatio, m_settings.directionShape, circleRadius, arm)
+                : nullptr;
+            if (image) {
+                painter.drawImage(QPointF(circleX, circleY) + image->origin, image->image);
+                painter.restore();
+                continue;
+            }
+            
             // Draw the appropriate shape
             switch (m_settings.directionShape) {
                 case CrosshairRenderer::DirectionShape::Circle:
@@ -394,7 +458,7 @@ void WindowsCrosshairRenderer::drawDirectionShapes(QPainter &painter, int startX
 
 double WindowsCrosshairRenderer::getUIScaleFactor() const
 {
-    QScreen *screen = QApplication::screenAt(QCursor::pos());
+    QScreen *screen = QApplication::screenAt(m_mousePos);
     if (!screen) {
         screen = QApplication::primaryScreen();
     }
@@ -403,6 +467,11 @@ double WindowsCrosshairRenderer::getUIScaleFactor() const
 
 int WindowsCrosshairRenderer::getScaledLineWidth() const
 {
+    // Called for every stroke, the prewarmed per screen widths spare the screen lookups
+    if (m_prewarmed && m_prewarmed->settings.lineWidth == m_settings.lineWidth) {
+        return m_prewarmed->baseThicknessAt(m_mousePos);
+    }
+    
     double scaleFactor = getUIScaleFactor();
     int scaledWidth = static_cast<int>(m_settings.lineWidth * scaleFactor);
     return qMax(3, scaledWidth);
@@ -25,7 +25,7 @@
 
 #include "CrosshairRenderer.h"
 #include <QWidget>
-#include <QTimer>
+#include <QRegion>
 #include <memory>
 
 class WindowsCrosshairRenderer : public QWidget, public CrosshairRenderer
@@ -41,27 +41,29 @@ public:
     
     void startRendering() override;
     void stopRendering() override;
+    void parkRendering() override;
     
     void updateSettings(const Settings& settings) override;
     void updateMousePosition(const QPoint& pos) override;
     
     bool isRendering() const override { return m_isRendering; }
+    bool supportsExtraPointers() const override { return true; }
+    bool drawsTaperSegments() const override { return true; }
     
 protected:
     void paintEvent(QPaintEvent *event) override;
     
-private slots:
-    void updateCrosshair();
-    
 private:
     void setupWindow();
-    void drawCrosshair(QPainter &painter);
-    void drawGradientLine(QPainter &painter, int startX, int startY, int endX, int endY, int totalDistance);
-    void drawDirectionShapes(QPainter &painter, int startX, int startY, int endX, int endY, int totalDistance);
+    QRegion crosshairRegion() const;
+    void drawCrosshair(QPainter &painter, const QPoint& pos, const QColor& color);
+    void drawGradientLine(QPainter &painter, int startX, int startY, int endX, int endY, int totalDistance, const QColor& color);
+    void drawDirectionShapes(QPainter &painter, int startX, int startY, int endX, int endY, int totalDistance, const QColor& color);
     double getUIScaleFactor() const;
     int getScaledLineWidth() const;
     
-    QTimer* m_updateTimer;
+    QRegion m_lastDamage;
+    bool m_parked;
 };
 
 #endif // WINDOWSCROSSHAIRRENDERER_H
\ No newline at end of file
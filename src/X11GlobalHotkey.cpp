@@ -0,0 +1,197 @@
+/*
+ * MouseCross - A crosshair overlay application for visually impaired users
+ * Copyright (C) 2025 Stefan Lohmaier <stefan@slohmaier.de>
+ *
+ * This file is part of MouseCross.
+ *
+ * MouseCross is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MouseCross is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with MouseCross. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Project website: https://slohmaier.de/mousecross
+ */
+
+#include "X11GlobalHotkey.h"
+#include "X11Support.h"
+#include <QCoreApplication>
+#include <QDebug>
+
+#include <X11/Xlib.h>
+#include <X11/XKBlib.h>
+#include <X11/keysym.h>
+#include <xcb/xcb.h>
+
+namespace {
+
+// Lock modifiers that must not stop the hotkey, grabbed in every combination
+const unsigned int LockMasks[] = { 0, LockMask, Mod2Mask, LockMask | Mod2Mask };
+
+bool s_grabFailed = false;
+
+int grabErrorHandler(Display*, XErrorEvent* error)
+{
+    if (error->error_code == BadAccess) {
+        s_grabFailed = true;
+    }
+    return 0;
+}
+
+KeySym toKeySym(Qt::Key key)
+{
+    if (key >= Qt::Key_A && key <= Qt::Key_Z) return XK_a + (key - Qt::Key_A);
+    if (key >= Qt::Key_0 && key <= Qt::Key_9) return XK_0 + (key - Qt::Key_0);
+    if (key >= Qt::Key_F1 && key <= Qt::Key_F35) return XK_F1 + (key - Qt::Key_F1);
+
+    switch (key) {
+    case Qt::Key_Space: return XK_space;
+    case Qt::Key_Escape: return XK_Escape;
+    case Qt::Key_Tab: return XK_Tab;
+    case Qt::Key_Return: return XK_Return;
+    case Qt::Key_Insert: return XK_Insert;
+    case Qt::Key_Delete: return XK_Delete;
+    case Qt::Key_Home: return XK_Home;
+    case Qt::Key_End: return XK_End;
+    case Qt::Key_PageUp: return XK_Page_Up;
+    case Qt::Key_PageDown: return XK_Page_Down;
+    case Qt::Key_Left: return XK_Left;
+    case Qt::Key_Right: return XK_Right;
+    case Qt::Key_Up: return XK_Up;
+    case Qt::Key_Down: return XK_Down;
+    case Qt::Key_Pause: return XK_Pause;
+    case Qt::Key_ScrollLock: return XK_Scroll_Lock;
+    default: return NoSymbol;
+    }
+}
+
+}
+
+X11GlobalHotkey::X11GlobalHotkey(QObject *parent)
+    : QObject(parent)
+    , m_keycode(0)
+    , m_modifiers(0)
+    , m_held(false)
+{
+}
+
+X11GlobalHotkey::~X11GlobalHotkey()
+{
+    unregister();
+}
+
+bool X11GlobalHotkey::isSupported()
+{
+    return X11Support::isAvailable();
+}
+
+bool X11GlobalHotkey::setShortcut(const QKeySequence& sequence)
+{
+    // Settings changes re-register the hotkey, keep an unchanged grab alive
+    if (isRegistered() && sequence == m_sequence) return true;
+
+    unregister();
+
+    Display* dpy = X11Support::display();
+    if (!dpy || sequence.isEmpty()) return false;
+
+    const QKeyCombination combination = sequence[0];
+    const KeySym keysym = toKeySym(combination.key());
+    const KeyCode keycode = keysym != NoSymbol ? XKeysymToKeycode(dpy, keysym) : 0;
+    if (!keycode) {
+        qWarning() << "Hotkey" << sequence.toString() << "cannot be mapped to an X11 key";
+        return false;
+    }
+
+    const Qt::KeyboardModifiers modifiers = combination.keyboardModifiers();
+    m_modifiers = 0;
+    if (modifiers & Qt::ShiftModifier) m_modifiers |= ShiftMask;
+    if (modifiers & Qt::ControlModifier) m_modifiers |= ControlMask;
+    if (modifiers & Qt::AltModifier) m_modifiers |= Mod1Mask;
+    if (modifiers & Qt::MetaModifier) m_modifiers |= Mod4Mask;
+    m_keycode = keycode;
+    m_sequence = sequence;
+
+    if (!grab(true)) {
+        qWarning() << "Hotkey" << sequence.toString() << "is already taken by another application";
+        grab(false);
+        m_keycode = 0;
+        return false;
+    }
+
+    // Without detectable auto repeat a held key sends release/press pairs
+    XkbSetDetectableAutoRepeat(dpy, True, nullptr);
+    QCoreApplication::instance()->installNativeEventFilter(this);
+    return true;
+}
+
+void X11GlobalHotkey::unregister()
+{
+    if (!m_keycode) return;
+
+    if (QCoreApplication::instance()) {
+        QCoreApplication::instance()->removeNativeEventFilter(this);
+    }
+    grab(false);
+    m_keycode = 0;
+    m_held = false;
+    m_sequence = QKeySequence();
+}
+
+bool X11GlobalHotkey::grab(bool enabled)
+{
+    Display* dpy = X11Support::display();
+    if (!dpy) return false;
+
+    // Grab errors arrive asynchronously, sync once to see them
+    XSync(dpy, False);
+    s_grabFailed = false;
+    XErrorHandler previous = XSetErrorHandler(grabErrorHandler);
+    for (unsigned int lockMask : LockMasks) {
+        if (enabled) {
+            XGrabKey(dpy, m_keycode, m_modifiers | lockMask, X11Support::rootWindow(), True,
+                     GrabModeAsync, GrabModeAsync);
+        } else {
+            XUngrabKey(dpy, m_keycode, m_modifiers | lockMask, X11Support::rootWindow());
+        }
+    }
+    XSync(dpy, False);
+    XSetErrorHandler(previous);
+    return !s_grabFailed;
+}
+
+bool X11GlobalHotkey::nativeEventFilter(const QByteArray& eventType, void* message, qintptr* result)
+{
+    Q_UNUSED(result);
+
+    if (eventType != "xcb_generic_event_t") return false;
+
+    auto* event = static_cast<xcb_generic_event_t*>(message);
+    const uint8_t responseType = event->response_type & ~0x80;
+    if (responseType != XCB_KEY_PRESS && responseType != XCB_KEY_RELEASE) return false;
+
+    auto* keyEvent = reinterpret_cast<xcb_key_press_event_t*>(event);
+    const unsigned int relevant = ShiftMask | ControlMask | Mod1Mask | Mod4Mask;
+    if (keyEvent->detail != m_keycode) return false;
+
+    if (responseType == XCB_KEY_PRESS) {
+        // Auto repeat sends further presses while held
+        if (m_held) return true;
+        if ((keyEvent->state & relevant) != m_modifiers) return false;
+        m_held = true;
+        emit pressed();
+    } else {
+        // Modifiers may already be up when the key is released
+        if (!m_held) return false;
+        m_held = false;
+        emit released();
+    }
+    return true;
+}
@@ -0,0 +1,66 @@
+/*
+ * MouseCross - A crosshair overlay application for visually impaired users
+ * Copyright (C) 2025 Stefan Lohmaier <stefan@slohmaier.de>
+ *
+ * This file is part of MouseCross.
+ *
+ * MouseCross is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MouseCross is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with MouseCross. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Project website: https://slohmaier.de/mousecross
+ */
+
+#ifndef X11GLOBALHOTKEY_H
+#define X11GLOBALHOTKEY_H
+
+#include <QObject>
+#include <QAbstractNativeEventFilter>
+#include <QKeySequence>
+
+// System wide hotkey on X11. The key is grabbed on the root window with
+// XGrabKey and its events are picked out of Qt's event stream by a native
+// event filter. Unlike the Windows and macOS hotkeys it also reports the
+// release, which the momentary (press and hold) mode needs.
+class X11GlobalHotkey : public QObject, public QAbstractNativeEventFilter
+{
+    Q_OBJECT
+
+public:
+    explicit X11GlobalHotkey(QObject *parent = nullptr);
+    ~X11GlobalHotkey() override;
+
+    // Requires the xcb platform
+    static bool isSupported();
+
+    // Grabs the first combination of sequence, false if it cannot be mapped or
+    // another client already grabbed it
+    bool setShortcut(const QKeySequence& sequence);
+    void unregister();
+    bool isRegistered() const { return m_keycode != 0; }
+
+    bool nativeEventFilter(const QByteArray& eventType, void* message, qintptr* result) override;
+
+signals:
+    void pressed();
+    void released();
+
+private:
+    bool grab(bool enabled);
+
+    unsigned int m_keycode;
+    unsigned int m_modifiers;
+    bool m_held;
+    QKeySequence m_sequence;
+};
+
+#endif // X11GLOBALHOTKEY_H
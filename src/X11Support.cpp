@@ -0,0 +1,170 @@
+/*
+ * MouseCross - A crosshair overlay application for visually impaired users
+ * Copyright (C) 2025 Stefan Lohmaier <stefan@slohmaier.de>
+ *
+ * This file is part of MouseCross.
+ *
+ * MouseCross is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MouseCross is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with MouseCross. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Project website: https://slohmaier.de/mousecross
+ */
+
+#include "X11Support.h"
+#include <QGuiApplication>
+#include <QScreen>
+#include <QByteArray>
+
+#include <X11/Xlib.h>
+
+namespace X11Support
+{
+
+bool isAvailable()
+{
+    return display() != nullptr;
+}
+
+Display* display()
+{
+    if (!qGuiApp) return nullptr;
+    if (auto *x11App = qGuiApp->nativeInterface<QNativeInterface::QX11Application>()) {
+        return x11App->display();
+    }
+    return nullptr;
+}
+
+xcb_connection_t* connection()
+{
+    if (!qGuiApp) return nullptr;
+    if (auto *x11App = qGuiApp->nativeInterface<QNativeInterface::QX11Application>()) {
+        return x11App->connection();
+    }
+    return nullptr;
+}
+
+unsigned long rootWindow()
+{
+    Display* dpy = display();
+    return dpy ? DefaultRootWindow(dpy) : 0;
+}
+
+int defaultScreen()
+{
+    Display* dpy = display();
+    return dpy ? DefaultScreen(dpy) : 0;
+}
+
+bool hasCompositingManager()
+{
+    Display* dpy = display();
+    if (!dpy) return false;
+
+    QByteArray selection = "_NET_WM_CM_S" + QByteArray::number(DefaultScreen(dpy));
+    Atom atom = XInternAtom(dpy, selection.constData(), False);
+    return XGetSelectionOwner(dpy, atom) != None;
+}
+
+bool hasExtension(const char* name)
+{
+    Display* dpy = display();
+    if (!dpy) return false;
+
+    int opcode = 0;
+    int eventBase = 0;
+    int errorBase = 0;
+    return XQueryExtension(dpy, name, &opcode, &eventBase, &errorBase);
+}
+
+bool isRemoteServer()
+{
+    Display* dpy = display();
+    if (!dpy) return false;
+
+    // Xvnc advertises its own extensions, xorgxrdp and Xvnc name their vendor
+    if (hasExtension("VNC-EXTENSION") || hasExtension("XVNC-EXTENSION")) return true;
+    const QByteArray vendor = QByteArray(ServerVendor(dpy)).toLower();
+    return vendor.contains("vnc") || vendor.contains("xrdp") || vendor.contains("x11rdp");
+}
+
+bool selectEvents(unsigned long window, long mask, bool enabled)
+{
+    Display* dpy = display();
+    if (!dpy || !window) return false;
+
+    XWindowAttributes attributes;
+    if (!XGetWindowAttributes(dpy, window, &attributes)) return false;
+    const long current = attributes.your_event_mask;
+    if (enabled ? (current & mask) == mask : !(current & mask)) return false;
+    XSelectInput(dpy, window, enabled ? current | mask : current & ~mask);
+    return true;
+}
+
+QPoint fromNativePixels(const QPoint& nativePos)
+{
+    // Qt keeps each screen's origin in native pixels and scales its extent by the
+    // device pixel ratio, map relative to the screen containing the point
+    const QList<QScreen*> screens = QGuiApplication::screens();
+    for (QScreen *screen : screens) {
+        const QRect geometry = screen->geometry();
+        const qreal ratio = screen->devicePixelRatio();
+        const QRect nativeGeometry(geometry.topLeft(), geometry.size() * ratio);
+        if (nativeGeometry.contains(nativePos)) {
+            return geometry.topLeft() + (nativePos - geometry.topLeft()) / ratio;
+        }
+    }
+    return nativePos;
+}
+
+namespace {
+
+QScreen* screenAt(const QPointF& pos)
+{
+    // Arm ends sit on the virtual desktop edge, which may be outside every
+    // screen in uneven layouts, so fall back to the nearest screen
+    QScreen* nearest = QGuiApplication::primaryScreen();
+    qreal nearestDistance = -1;
+    const QList<QScreen*> screens = QGuiApplication::screens();
+    for (QScreen *screen : screens) {
+        const QRectF geometry = screen->geometry();
+        if (geometry.contains(pos)) return screen;
+
+        const qreal dx = qMax(qMax(geometry.left() - pos.x(), pos.x() - geometry.right()), 0.0);
+        const qreal dy = qMax(qMax(geometry.top() - pos.y(), pos.y() - geometry.bottom()), 0.0);
+        const qreal distance = dx * dx + dy * dy;
+        if (nearestDistance < 0 || distance < nearestDistance) {
+            nearest = screen;
+            nearestDistance = distance;
+        }
+    }
+    return nearest;
+}
+
+}
+
+QPointF toNativePixels(const QPointF& pos)
+{
+    QScreen* screen = screenAt(pos);
+    if (!screen) return pos;
+
+    const QPointF origin = screen->geometry().topLeft();
+    return origin + (pos - origin) * screen->devicePixelRatio();
+}
+
+qreal devicePixelRatioAt(const QPointF& pos)
+{
+    QScreen* screen = screenAt(pos);
+    return screen ? screen->devicePixelRatio() : 1.0;
+}
+
+}
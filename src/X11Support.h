@@ -0,0 +1,66 @@
+/*
+ * MouseCross - A crosshair overlay application for visually impaired users
+ * Copyright (C) 2025 Stefan Lohmaier <stefan@slohmaier.de>
+ *
+ * This file is part of MouseCross.
+ *
+ * MouseCross is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MouseCross is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with MouseCross. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Project website: https://slohmaier.de/mousecross
+ */
+
+#ifndef X11SUPPORT_H
+#define X11SUPPORT_H
+
+#include <QPoint>
+#include <QPointF>
+
+typedef struct _XDisplay Display;
+typedef struct xcb_connection_t xcb_connection_t;
+
+// Small helpers shared by the native X11 backends. All functions return
+// null/false when the application is not running on the xcb platform.
+namespace X11Support
+{
+    bool isAvailable();
+    Display* display();
+    xcb_connection_t* connection();
+    unsigned long rootWindow();
+    int defaultScreen();
+
+    // True when a compositing manager owns the _NET_WM_CM_Sn selection
+    bool hasCompositingManager();
+
+    // True when the server advertises the named extension, e.g. "MIT-SHM"
+    bool hasExtension(const char* name);
+
+    // True when the server is a VNC or RDP server rather than a local display
+    bool isRemoteServer();
+
+    // Adds or removes event mask bits on a window and keeps the rest. The mask is per
+    // client and Qt shares the connection, so false is returned when the bits were
+    // already in that state; callers only remove bits they added themselves.
+    bool selectEvents(unsigned long window, long mask, bool enabled);
+
+    // Maps root window coordinates to Qt's device independent coordinates
+    QPoint fromNativePixels(const QPoint& nativePos);
+
+    // Inverse of fromNativePixels, maps Qt coordinates to root window coordinates
+    QPointF toNativePixels(const QPointF& pos);
+
+    // Device pixel ratio of the screen containing, or nearest to, a Qt coordinate
+    qreal devicePixelRatioAt(const QPointF& pos);
+}
+
+#endif // X11SUPPORT_H
@@ -0,0 +1,281 @@
+/*
+ * MouseCross - A crosshair overlay application for visually impaired users
+ * Copyright (C) 2025 Stefan Lohmaier <stefan@slohmaier.de>
+ *
+ * This file is part of MouseCross.
+ *
+ * MouseCross is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MouseCross is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with MouseCross. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Project website: https://slohmaier.de/mousecross
+ */
+
+#include "X11XorCrosshairRenderer.h"
+#include "CrosshairGeometry.h"
+#include "X11Support.h"
+#include <QApplication>
+#include <QScreen>
+#include <QCursor>
+#include <QPainterPath>
+#include <vector>
+
+#include <X11/Xlib.h>
+#include <X11/Xutil.h>
+
+struct X11XorCrosshairRenderer::Frame {
+    Region arms = nullptr;                      // Union of arms and closing lines, inverted once
+    std::vector<std::vector<XPoint>> polygons;  // Direction shapes other than circles
+    std::vector<XArc> arcs;                     // Circle shapes
+    std::vector<XRectangle> centerLines;
+
+    ~Frame()
+    {
+        if (arms) XDestroyRegion(arms);
+    }
+};
+
+namespace {
+
+// Screens can have different device pixel ratios, so every point is mapped
+// through the screen it lies on rather than one global scale
+XPoint toXPoint(const QPointF& point)
+{
+    const QPointF native = X11Support::toNativePixels(point);
+    XPoint xpoint;
+    xpoint.x = static_cast<short>(qRound(native.x()));
+    xpoint.y = static_cast<short>(qRound(native.y()));
+    return xpoint;
+}
+
+XRectangle toXRectangle(const QRectF& rect)
+{
+    QRect aligned = QRectF(X11Support::toNativePixels(rect.topLeft()),
+                           X11Support::toNativePixels(rect.bottomRight())).toAlignedRect();
+    XRectangle xrect;
+    xrect.x = static_cast<short>(aligned.x());
+    xrect.y = static_cast<short>(aligned.y());
+    xrect.width = static_cast<unsigned short>(qMax(0, aligned.width()));
+    xrect.height = static_cast<unsigned short>(qMax(0, aligned.height()));
+    return xrect;
+}
+
+}
+
+X11XorCrosshairRenderer::X11XorCrosshairRenderer()
+    : m_display(nullptr)
+    , m_gc(nullptr)
+{
+}
+
+X11XorCrosshairRenderer::~X11XorCrosshairRenderer()
+{
+    cleanup();
+}
+
+bool X11XorCrosshairRenderer::isSupported()
+{
+    return X11Support::isAvailable();
+}
+
+bool X11XorCrosshairRenderer::initialize()
+{
+    m_display = X11Support::display();
+    if (!m_display) return false;
+
+    XGCValues values;
+    values.function = GXxor;
+    values.subwindow_mode = IncludeInferiors;
+    values.graphics_exposures = False;
+    m_gc = XCreateGC(m_display, X11Support::rootWindow(),
+                     GCFunction | GCSubwindowMode | GCGraphicsExposures, &values);
+
+    // Geometry is built in Qt coordinates and mapped to root window pixels per screen
+    m_screenGeometry = QApplication::primaryScreen()->virtualGeometry();
+
+    updateForeground();
+    return true;
+}
+
+void X11XorCrosshairRenderer::cleanup()
+{
+    stopRendering();
+
+    if (m_display && m_gc) {
+        XFreeGC(m_display, m_gc);
+        XFlush(m_display);
+    }
+    m_gc = nullptr;
+    m_display = nullptr;
+}
+
+void X11XorCrosshairRenderer::startRendering()
+{
+    if (m_isRendering) return;
+
+    m_isRendering = true;
+    updateMousePosition(QCursor::pos());
+}
+
+void X11XorCrosshairRenderer::stopRendering()
+{
+    if (!m_isRendering) return;
+
+    eraseFrame();
+    if (m_display) XFlush(m_display);
+    m_isRendering = false;
+}
+
+void X11XorCrosshairRenderer::updateSettings(const Settings& settings)
+{
+    // Erase with the old settings before the foreground pixel changes
+    eraseFrame();
+    m_settings = settings;
+    updateForeground();
+
+    if (m_isRendering && m_display) {
+        m_drawnFrame = buildFrame();
+        drawFrame(*m_drawnFrame, X11Support::rootWindow());
+        XFlush(m_display);
+    }
+}
+
+void X11XorCrosshairRenderer::updateMousePosition(const QPoint& pos)
+{
+    m_mousePos = pos;
+    if (!m_isRendering || !m_display) return;
+
+    eraseFrame();
+    m_drawnFrame = buildFrame();
+    drawFrame(*m_drawnFrame, X11Support::rootWindow());
+    XFlush(m_display);
+    notifyFramePresented();
+}
+
+void X11XorCrosshairRenderer::updateForeground()
+{
+    if (!m_display || !m_gc) return;
+
+    // XOR with the selected color; the default white gives a plain inversion
+    XColor color;
+    color.red = static_cast<unsigned short>(m_settings.color.red() * 257);
+    color.green = static_cast<unsigned short>(m_settings.color.green() * 257);
+    color.blue = static_cast<unsigned short>(m_settings.color.blue() * 257);
+    color.flags = DoRed | DoGreen | DoBlue;
+
+    Colormap colormap = DefaultColormap(m_display, X11Support::defaultScreen());
+    unsigned long pixel = WhitePixel(m_display, X11Support::defaultScreen());
+    if (XAllocColor(m_display, colormap, &color)) {
+        pixel = color.pixel;
+    }
+    XSetForeground(m_display, m_gc, pixel);
+}
+
+std::unique_ptr<X11XorCrosshairRenderer::Frame> X11XorCrosshairRenderer::buildFrame() const
+{
+    auto frame = std::make_unique<Frame>();
+    CrosshairGeometry geometry(m_settings, m_mousePos, m_screenGeometry, getScaledLineWidth());
+
+    // Overlapping XOR primitives cancel out, so arms and closing lines are merged
+    // into one region and inverted exactly once
+    frame->arms = XCreateRegion();
+    for (int i = 0; i < CrosshairGeometry::ArmCount; ++i) {
+        const CrosshairGeometry::ArmGeometry& arm = geometry.arm(static_cast<CrosshairGeometry::Arm>(i));
+
+        std::vector<XPoint> points;
+        for (const QPointF& point : arm.outline()) {
+            points.push_back(toXPoint(point));
+        }
+        if (points.size() >= 3) {
+            Region armRegion = XPolygonRegion(points.data(), static_cast<int>(points.size()), WindingRule);
+            XUnionRegion(frame->arms, armRegion, frame->arms);
+            XDestroyRegion(armRegion);
+        }
+
+        XRectangle closingLine = toXRectangle(arm.closingLine());
+        XUnionRectWithRegion(&closingLine, frame->arms, frame->arms);
+
+        // Center lines and shapes are XORed on top and show up as contrast cut-outs
+        frame->centerLines.push_back(toXRectangle(arm.centerLine()));
+    }
+
+    for (const CrosshairGeometry::ShapeInstance& shape : geometry.shapes()) {
+        if (m_settings.directionShape == DirectionShape::Circle) {
+            const QPointF center = X11Support::toNativePixels(shape.center);
+            const qreal radius = shape.radius * X11Support::devicePixelRatioAt(shape.center);
+            XArc arc;
+            arc.x = static_cast<short>(qRound(center.x() - radius));
+            arc.y = static_cast<short>(qRound(center.y() - radius));
+            arc.width = arc.height = static_cast<unsigned short>(qRound(radius * 2));
+            arc.angle1 = 0;
+            arc.angle2 = 360 * 64;
+            frame->arcs.push_back(arc);
+            continue;
+        }
+
+        QPointF towardsCenter = geometry.arm(shape.arm).towardsCenter();
+        QPainterPath path = CrosshairGeometry::shapePath(m_settings.directionShape, shape.center,
+                                                         shape.radius, towardsCenter).simplified();
+        for (const QPolygonF& polygon : path.toFillPolygons()) {
+            std::vector<XPoint> points;
+            for (const QPointF& point : polygon) {
+                points.push_back(toXPoint(point));
+            }
+            frame->polygons.push_back(std::move(points));
+        }
+    }
+
+    return frame;
+}
+
+void X11XorCrosshairRenderer::drawFrame(const Frame& frame, unsigned long drawable)
+{
+    if (!m_display || !m_gc) return;
+
+    if (frame.arms && !XEmptyRegion(frame.arms)) {
+        XRectangle bounds;
+        XClipBox(frame.arms, &bounds);
+        XSetRegion(m_display, m_gc, frame.arms);
+        XFillRectangle(m_display, drawable, m_gc, bounds.x, bounds.y, bounds.width, bounds.height);
+        XSetClipMask(m_display, m_gc, None);
+    }
+
+    for (const std::vector<XPoint>& polygon : frame.polygons) {
+        XFillPolygon(m_display, drawable, m_gc, const_cast<XPoint*>(polygon.data()),
+                     static_cast<int>(polygon.size()), Complex, CoordModeOrigin);
+    }
+
+    if (!frame.arcs.empty()) {
+        XFillArcs(m_display, drawable, m_gc, const_cast<XArc*>(frame.arcs.data()), static_cast<int>(frame.arcs.size()));
+    }
+
+    if (!frame.centerLines.empty()) {
+        XFillRectangles(m_display, drawable, m_gc, const_cast<XRectangle*>(frame.centerLines.data()),
+                        static_cast<int>(frame.centerLines.size()));
+    }
+}
+
+void X11XorCrosshairRenderer::eraseFrame()
+{
+    if (!m_drawnFrame) return;
+
+    // XOR is its own inverse, drawing the same frame again restores the screen
+    drawFrame(*m_drawnFrame, X11Support::rootWindow());
+    m_drawnFrame.reset();
+}
+
+int X11XorCrosshairRenderer::getScaledLineWidth() const
+{
+    const qreal scale = X11Support::devicePixelRatioAt(m_mousePos);
+    int scaledWidth = static_cast<int>(m_settings.lineWidth * scale);
+    return qMax(3, scaledWidth);
+}
@@ -0,0 +1,73 @@
+/*
+ * MouseCross - A crosshair overlay application for visually impaired users
+ * Copyright (C) 2025 Stefan Lohmaier <stefan@slohmaier.de>
+ *
+ * This file is part of MouseCross.
+ *
+ * MouseCross is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MouseCross is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with MouseCross. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Project website: https://slohmaier.de/mousecross
+ */
+
+#ifndef X11XORCROSSHAIRRENDERER_H
+#define X11XORCROSSHAIRRENDERER_H
+
+#include "CrosshairRenderer.h"
+#include <QObject>
+#include <memory>
+
+typedef struct _XDisplay Display;
+
+// Fallback renderer for X11 sessions without a compositing manager. The crosshair
+// is XORed straight onto the root window (including inferiors) and erased by
+// XORing the previous frame again, so no overlay window or backing store is needed.
+// Windows repainting underneath the crosshair can leave stale pixels until the
+// next move, the usual trade-off of XOR drawing.
+class X11XorCrosshairRenderer : public QObject, public CrosshairRenderer
+{
+    Q_OBJECT
+
+public:
+    X11XorCrosshairRenderer();
+    ~X11XorCrosshairRenderer() override;
+
+    static bool isSupported();
+
+    bool initialize() override;
+    void cleanup() override;
+
+    void startRendering() override;
+    void stopRendering() override;
+
+    void updateSettings(const Settings& settings) override;
+    void updateMousePosition(const QPoint& pos) override;
+
+    bool isRendering() const override { return m_isRendering; }
+    int presentationDelayFrames() const override { return 0; }
+
+private:
+    struct Frame;
+
+    std::unique_ptr<Frame> buildFrame() const;
+    void drawFrame(const Frame& frame, unsigned long drawable);
+    void eraseFrame();
+    void updateForeground();
+    int getScaledLineWidth() const;
+
+    Display* m_display;
+    struct _XGC* m_gc;
+    std::unique_ptr<Frame> m_drawnFrame;
+};
+
+#endif // X11XORCROSSHAIRRENDERER_H
@@ -0,0 +1,202 @@
+/*
+ * MouseCross - A crosshair overlay application for visually impaired users
+ * Copyright (C) 2025 Stefan Lohmaier <stefan@slohmaier.de>
+ *
+ * This file is part of MouseCross.
+ *
+ * MouseCross is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MouseCross is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with MouseCross. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Project website: https://slohmaier.de/mousecross
+ */
+
+#include "XInput2CursorSource.h"
+#include "X11Support.h"
+#include <QCoreApplication>
+
+#include <X11/Xlib.h>
+#include <X11/extensions/XInput2.h>
+#include <xcb/xcb.h>
+
+namespace {
+
+int xinputOpcode()
+{
+    Display* dpy = X11Support::display();
+    if (!dpy) return -1;
+
+    int opcode = 0;
+    int eventBase = 0;
+    int errorBase = 0;
+    if (!XQueryExtension(dpy, "XInputExtension", &opcode, &eventBase, &errorBase)) return -1;
+
+    // Raw events need XI 2.0
+    int major = 2;
+    int minor = 0;
+    if (XIQueryVersion(dpy, &major, &minor) != Success) return -1;
+    return opcode;
+}
+
+}
+
+XInput2CursorSource::XInput2CursorSource(QObject *parent)
+    : CursorSource(parent)
+    , m_xiOpcode(-1)
+{
+}
+
+XInput2CursorSource::~XInput2CursorSource()
+{
+    stop();
+}
+
+bool XInput2CursorSource::isSupported()
+{
+    return xinputOpcode() >= 0;
+}
+
+bool XInput2CursorSource::start()
+{
+    if (isActive()) return true;
+
+    m_xiOpcode = xinputOpcode();
+    if (m_xiOpcode < 0) return false;
+
+    QCoreApplication::instance()->installNativeEventFilter(this);
+    selectRawMotion(true);
+    refreshMasterPointers();
+    setActive(true);
+    return true;
+}
+
+void XInput2CursorSource::stop()
+{
+    if (!isActive()) return;
+
+    selectRawMotion(false);
+    QCoreApplication::instance()->removeNativeEventFilter(this);
+    setActive(false);
+}
+
+void XInput2CursorSource::selectRawMotion(bool enabled)
+{
+    Display* dpy = X11Support::display();
+    if (!dpy) return;
+
+    // Raw events are only delivered to the root window. X keeps one mask per client,
+    // window and device and this is Qt's connection, so add to whatever Qt selected
+    // there and put it back on stop. Qt already selects hierarchy changes on the
+    // root window, they reach the filter without selecting them here.
+    const Window root = X11Support::rootWindow();
+    QByteArray bits;
+    if (enabled) {
+        m_savedRootMask.clear();
+        int count = 0;
+        XIEventMask* selected = XIGetSelectedEvents(dpy, root, &count);
+        for (int i = 0; i < count; ++i) {
+            if (selected[i].deviceid == XIAllMasterDevices) {
+                m_savedRootMask = QByteArray(reinterpret_cast<const char*>(selected[i].mask), selected[i].mask_len);
+            }
+        }
+        if (selected) XFree(selected);
+
+        bits = m_savedRootMask;
+        if (bits.size() < XIMaskLen(XI_LASTEVENT)) bits.resize(XIMaskLen(XI_LASTEVENT), '\0');
+        XISetMask(reinterpret_cast<unsigned char*>(bits.data()), XI_RawMotion);
+    } else {
+        bits = m_savedRootMask;
+        m_savedRootMask.clear();
+    }
+
+    XIEventMask mask;
+    mask.deviceid = XIAllMasterDevices;
+    mask.mask_len = bits.size();
+    mask.mask = reinterpret_cast<unsigned char*>(bits.data());
+    XISelectEvents(dpy, root, &mask, 1);
+    XFlush(dpy);
+}
+
+void XInput2CursorSource::refreshMasterPointers()
+{
+    m_extraMasters.clear();
+
+    Display* dpy = X11Support::display();
+    if (!dpy) return;
+
+    // The client pointer drives the core cursor and thus queryPosition()
+    int clientPointer = 0;
+    XIGetClientPointer(dpy, None, &clientPointer);
+
+    int count = 0;
+    XIDeviceInfo* devices = XIQueryDevice(dpy, XIAllMasterDevices, &count);
+    for (int i = 0; i < count; ++i) {
+        if (devices[i].use == XIMasterPointer && devices[i].deviceid != clientPointer) {
+            m_extraMasters.append(devices[i].deviceid);
+        }
+    }
+    XIFreeDeviceInfo(devices);
+}
+
+QVector<QPoint> XInput2CursorSource::queryExtraPointers() const
+{
+    QVector<QPoint> positions;
+    Display* dpy = X11Support::display();
+    if (!dpy || m_extraMasters.isEmpty()) return positions;
+
+    // One round trip per extra master, only paid on multi-pointer setups
+    positions.reserve(m_extraMasters.size());
+    for (int deviceId : m_extraMasters) {
+        Window root = 0;
+        Window child = 0;
+        double rootX = 0;
+        double rootY = 0;
+        double winX = 0;
+        double winY = 0;
+        XIButtonState buttons = {};
+        XIModifierState modifiers = {};
+        XIGroupState group = {};
+        if (XIQueryPointer(dpy, deviceId, X11Support::rootWindow(), &root, &child,
+                           &rootX, &rootY, &winX, &winY, &buttons, &modifiers, &group)) {
+            positions.append(X11Support::fromNativePixels(QPoint(qRound(rootX), qRound(rootY))));
+        }
+        XFree(buttons.mask);
+    }
+    return positions;
+}
+
+bool XInput2CursorSource::nativeEventFilter(const QByteArray& eventType, void* message, qintptr* result)
+{
+    Q_UNUSED(result);
+
+    if (eventType != "xcb_generic_event_t") return false;
+
+    auto* event = static_cast<xcb_generic_event_t*>(message);
+    if ((event->response_type & ~0x80) != XCB_GE_GENERIC) return false;
+
+    auto* genericEvent = reinterpret_cast<xcb_ge_generic_event_t*>(event);
+    if (genericEvent->extension != m_xiOpcode) return false;
+
+    if (genericEvent->event_type == XI_HierarchyChanged) {
+        // A master pointer came or went, redraw so its crosshair appears or vanishes
+        refreshMasterPointers();
+        reportMotion();
+        return false;
+    }
+    if (genericEvent->event_type != XI_RawMotion) return false;
+
+    // Raw events carry device deltas only, the position is queried once per frame
+    reportMotion();
+
+    // Qt might have selected raw events itself, let it see them as well
+    return false;
+}
@@ -0,0 +1,64 @@
+/*
+ * MouseCross - A crosshair overlay application for visually impaired users
+ * Copyright (C) 2025 Stefan Lohmaier <stefan@slohmaier.de>
+ *
+ * This file is part of MouseCross.
+ *
+ * MouseCross is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MouseCross is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with MouseCross. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Project website: https://slohmaier.de/mousecross
+ */
+
+#ifndef XINPUT2CURSORSOURCE_H
+#define XINPUT2CURSORSOURCE_H
+
+#include "CursorSource.h"
+#include <QAbstractNativeEventFilter>
+#include <QVector>
+#include <QByteArray>
+
+// Event-driven cursor source for X11. Selects XInput2 raw motion on the root
+// window and only asks for the pointer position after motion was reported,
+// at most once per frame. An idle pointer costs no wakeups and no round trips.
+// With several master pointers (MPX) the others are reported as extra pointers.
+class XInput2CursorSource : public CursorSource, public QAbstractNativeEventFilter
+{
+    Q_OBJECT
+
+public:
+    explicit XInput2CursorSource(QObject *parent = nullptr);
+    ~XInput2CursorSource() override;
+
+    // Requires the xcb platform and XInput 2.0 on the server
+    static bool isSupported();
+
+    QString name() const override { return QStringLiteral("xinput2"); }
+    bool start() override;
+    void stop() override;
+
+    bool nativeEventFilter(const QByteArray& eventType, void* message, qintptr* result) override;
+
+protected:
+    QVector<QPoint> queryExtraPointers() const override;
+
+private:
+    void selectRawMotion(bool enabled);
+    void refreshMasterPointers();
+
+    int m_xiOpcode;
+    QVector<int> m_extraMasters;
+    QByteArray m_savedRootMask; // Master device mask on the root window before start()
+};
+
+#endif // XINPUT2CURSORSOURCE_H
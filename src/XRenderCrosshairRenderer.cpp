@@ -0,0 +1,498 @@
+/*
+ * MouseCross - A crosshair overlay application for visually impaired users
+ * Copyright (C) 2025 Stefan Lohmaier <stefan@slohmaier.de>
+ *
+ * This file is part of MouseCross.
+ *
+ * MouseCross is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MouseCross is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with MouseCross. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Project website: https://slohmaier.de/mousecross
+ */
+
+#include "XRenderCrosshairRenderer.h"
+#include "CrosshairGeometry.h"
+#include "X11Support.h"
+#include "RenderPrewarmer.h"
+#include <QApplication>
+#include <QScreen>
+#include <QCursor>
+#include <QImage>
+#include <algorithm>
+
+#include <X11/Xlib.h>
+#include <X11/Xutil.h>
+#include <X11/extensions/Xrender.h>
+
+namespace {
+
+// Splits a convex polygon into horizontal trapezoids as required by CompositeTrapezoids
+void appendTrapezoids(const QPolygonF& polygon, double scale, QVector<XTrapezoid>& trapezoids)
+{
+    const int count = polygon.size();
+    if (count < 3) return;
+
+    std::vector<double> ys;
+    ys.reserve(count);
+    for (const QPointF& point : polygon) {
+        ys.push_back(point.y() * scale);
+    }
+    std::sort(ys.begin(), ys.end());
+    ys.erase(std::unique(ys.begin(), ys.end()), ys.end());
+
+    for (size_t i = 0; i + 1 < ys.size(); ++i) {
+        double top = ys[i];
+        double bottom = ys[i + 1];
+        double mid = (top + bottom) / 2.0;
+
+        // Find the two edges crossing this band
+        XLineFixed edges[2];
+        double edgeX[2];
+        int found = 0;
+        for (int j = 0; j < count && found < 2; ++j) {
+            QPointF a = polygon[j] * scale;
+            QPointF b = polygon[(j + 1) % count] * scale;
+            if ((a.y() <= mid && b.y() > mid) || (b.y() <= mid && a.y() > mid)) {
+                edgeX[found] = a.x() + (mid - a.y()) * (b.x() - a.x()) / (b.y() - a.y());
+                edges[found].p1.x = XDoubleToFixed(a.x());
+                edges[found].p1.y = XDoubleToFixed(a.y());
+                edges[found].p2.x = XDoubleToFixed(b.x());
+                edges[found].p2.y = XDoubleToFixed(b.y());
+                ++found;
+            }
+        }
+        if (found != 2) continue;
+
+        XTrapezoid trapezoid;
+        trapezoid.top = XDoubleToFixed(top);
+        trapezoid.bottom = XDoubleToFixed(bottom);
+        trapezoid.left = edgeX[0] <= edgeX[1] ? edges[0] : edges[1];
+        trapezoid.right = edgeX[0] <= edgeX[1] ? edges[1] : edges[0];
+        trapezoids.append(trapezoid);
+    }
+}
+
+XRectangle toXRectangle(const QRectF& rect, double scale)
+{
+    QRect aligned = QRectF(rect.x() * scale, rect.y() * scale,
+                           rect.width() * scale, rect.height() * scale).toAlignedRect();
+    XRectangle xrect;
+    xrect.x = static_cast<short>(aligned.x());
+    xrect.y = static_cast<short>(aligned.y());
+    xrect.width = static_cast<unsigned short>(qMax(0, aligned.width()));
+    xrect.height = static_cast<unsigned short>(qMax(0, aligned.height()));
+    return xrect;
+}
+
+XRenderColor toRenderColor(const QColor& color)
+{
+    // XRender expects premultiplied 16 bit channels
+    XRenderColor renderColor;
+    renderColor.alpha = static_cast<unsigned short>(color.alpha() * 257);
+    renderColor.red = static_cast<unsigned short>(color.red() * color.alpha() * 257 / 255);
+    renderColor.green = static_cast<unsigned short>(color.green() * color.alpha() * 257 / 255);
+    renderColor.blue = static_cast<unsigned short>(color.blue() * color.alpha() * 257 / 255);
+    return renderColor;
+}
+
+QColor inverseOf(const QColor& color)
+{
+    int r, g, b;
+    color.getRgb(&r, &g, &b);
+    return QColor(255 - r, 255 - g, 255 - b);
+}
+
+}
+
+XRenderCrosshairRenderer::XRenderCrosshairRenderer()
+    : QWidget(nullptr)
+    , m_display(nullptr)
+    , m_windowPicture(0)
+    , m_parked(false)
+{
+}
+
+XRenderCrosshairRenderer::~XRenderCrosshairRenderer()
+{
+    cleanup();
+}
+
+bool XRenderCrosshairRenderer::isSupported()
+{
+    Display* dpy = X11Support::display();
+    if (!dpy) return false;
+
+    int eventBase = 0;
+    int errorBase = 0;
+    if (!XRenderQueryExtension(dpy, &eventBase, &errorBase)) return false;
+
+    // Solid fill pictures need RENDER 0.10
+    int major = 0;
+    int minor = 0;
+    if (!XRenderQueryVersion(dpy, &major, &minor)) return false;
+    return major > 0 || minor >= 10;
+}
+
+bool XRenderCrosshairRenderer::initialize()
+{
+    if (!isSupported()) return false;
+
+    m_display = X11Support::display();
+    setupWindow();
+
+    XWindowAttributes attributes;
+    if (!XGetWindowAttributes(m_display, winId(), &attributes)) return false;
+
+    XRenderPictFormat* format = XRenderFindVisualFormat(m_display, attributes.visual);
+    if (!format) return false;
+
+    m_windowPicture = XRenderCreatePicture(m_display, winId(), format, 0, nullptr);
+
+    return true;
+}
+
+void XRenderCrosshairRenderer::cleanup()
+{
+    stopRendering();
+
+    if (!m_display) return;
+
+    releaseGlyphs();
+    releaseFills();
+    if (m_windowPicture) {
+        XRenderFreePicture(m_display, m_windowPicture);
+        m_windowPicture = 0;
+    }
+    XFlush(m_display);
+    m_display = nullptr;
+}
+
+void XRenderCrosshairRenderer::setupWindow()
+{
+    setWindowFlags(Qt::WindowStaysOnTopHint |
+                  Qt::FramelessWindowHint |
+                  Qt::Tool |
+                  Qt::WindowTransparentForInput);
+
+    setAttribute(Qt::WA_TranslucentBackground);
+    setAttribute(Qt::WA_ShowWithoutActivating);
+    setAttribute(Qt::WA_NoSystemBackground);
+    // All drawing goes straight to the X window, bypass Qt's backing store
+    setAttribute(Qt::WA_PaintOnScreen);
+
+    // Cover all screens
+    m_screenGeometry = QRect();
+    for (QScreen *screen : QApplication::screens()) {
+        m_screenGeometry = m_screenGeometry.united(screen->geometry());
+    }
+    setGeometry(m_screenGeometry);
+}
+
+void XRenderCrosshairRenderer::startRendering()
+{
+    if (m_isRendering) return;
+
+    // A parked overlay is still mapped, drawing the crosshair is all that is left
+    if (!m_parked) {
+        show();
+        raise();
+    }
+
+    m_parked = false;
+    m_isRendering = true;
+    updateMousePosition(QCursor::pos());
+}
+
+void XRenderCrosshairRenderer::stopRendering()
+{
+    if (!m_isRendering && !m_parked) return;
+
+    hide();
+    m_lastDamage.clear();
+    m_isRendering = false;
+    m_parked = false;
+}
+
+void XRenderCrosshairRenderer::parkRendering()
+{
+    if (!m_isRendering) return;
+
+    m_isRendering = false;
+    m_parked = true;
+    if (m_display && m_windowPicture) {
+        clearDamage(m_windowPicture);
+        XFlush(m_display);
+    }
+}
+
+void XRenderCrosshairRenderer::updateSettings(const Settings& settings)
+{
+    m_settings = settings;
+    setWindowOpacity(settings.opacity);
+
+    if (!m_display) return;
+
+    // Glyphs are keyed by shape and radius, fills by colour, so both caches
+    // survive profile switches and switching back draws without uploads
+    if (m_isRendering) {
+        renderFrame();
+    }
+}
+
+void XRenderCrosshairRenderer::updateMousePosition(const QPoint& pos)
+{
+    m_mousePos = pos;
+    if (m_isRendering) {
+        renderFrame();
+    }
+}
+
+void XRenderCrosshairRenderer::paintEvent(QPaintEvent *event)
+{
+    Q_UNUSED(event);
+
+    // Exposed contents are undefined, start from a fully transparent window
+    m_lastDamage = { QRect(QPoint(0, 0), size() * devicePixelRatioF()) };
+    if (m_parked) {
+        if (m_windowPicture) {
+            clearDamage(m_windowPicture);
+        }
+        return;
+    }
+    renderFrame();
+}
+
+void XRenderCrosshairRenderer::renderFrame()
+{
+    renderFrame(m_windowPicture);
+    notifyFramePresented();
+}
+
+void XRenderCrosshairRenderer::renderFrame(unsigned long target)
+{
+    if (!m_display || !target) return;
+
+    clearDamage(target);
+
+    // Extra pointers first so the main crosshair stays on top where they cross
+    for (int i = 0; i < m_extraPointers.size(); ++i) {
+        renderCrosshair(target, m_extraPointers[i], i + 1);
+    }
+    renderCrosshair(target, m_mousePos, 0);
+
+    XFlush(m_display);
+}
+
+void XRenderCrosshairRenderer::renderCrosshair(unsigned long target, const QPoint& pos, int pointerIndex)
+{
+    const double scale = devicePixelRatioF();
+    const QRect localScreen(QPoint(0, 0), m_screenGeometry.size());
+    const int baseThickness = getScaledLineWidth();
+    CrosshairGeometry geometry(m_settings, pos - m_screenGeometry.topLeft(), localScreen, baseThickness);
+
+    const PointerFill& fill = fillFor(pointerIndex);
+    const int op = m_settings.inverted ? PictOpDifference : PictOpOver;
+    // A1 masks give hard edges, cheaper to rasterize and to send over the wire
+    XRenderPictFormat* maskFormat = XRenderFindStandardFormat(m_display,
+                                                              m_settings.antialiasing ? PictStandardA8 : PictStandardA1);
+    XRenderColor color = toRenderColor(pointerColor(pointerIndex));
+
+    QVector<XRectangle> closingLines;
+    QVector<XRectangle> centerLines;
+    QVector<XTrapezoid> outer;
+    QVector<XTrapezoid> inner;
+    for (int i = 0; i < CrosshairGeometry::ArmCount; ++i) {
+        const CrosshairGeometry::ArmGeometry& arm = geometry.arm(static_cast<CrosshairGeometry::Arm>(i));
+        closingLines.append(toXRectangle(arm.closingLine(), scale));
+        centerLines.append(toXRectangle(arm.centerLine(), scale));
+        appendTrapezoids(arm.outline(), scale, outer);
+        if (!m_settings.inverted && !m_settings.solidArms) {
+            appendTrapezoids(arm.outline(0.5), scale, inner);
+        }
+    }
+
+    XRenderFillRectangles(m_display, op, target, &color, closingLines.data(), closingLines.size());
+
+    if (!outer.isEmpty()) {
+        XRenderCompositeTrapezoids(m_display, op, fill.color, target, maskFormat,
+                                   0, 0, outer.data(), outer.size());
+    }
+    if (!inner.isEmpty()) {
+        XRenderCompositeTrapezoids(m_display, PictOpOver, fill.inverse, target, maskFormat,
+                                   0, 0, inner.data(), inner.size());
+    }
+
+    for (const CrosshairGeometry::ShapeInstance& shape : geometry.shapes()) {
+        const CrosshairGeometry::ArmGeometry& arm = geometry.arm(shape.arm);
+        const Glyph& glyph = glyphFor(m_settings.directionShape, shape.radius, shape.arm, arm.towardsCenter());
+        if (!glyph.picture) continue;
+
+        int dstX = qRound(shape.center.x() * scale) + glyph.originX;
+        int dstY = qRound(shape.center.y() * scale) + glyph.originY;
+        XRenderComposite(m_display, op, fill.color, glyph.picture, target,
+                         0, 0, 0, 0, dstX, dstY, glyph.width, glyph.height);
+    }
+
+    XRenderFillRectangles(m_display, op, target, &color, centerLines.data(), centerLines.size());
+
+    // Remember what we touched so the next frame only clears these bands
+    auto scaled = [scale](const QRect& rect) {
+        return QRectF(rect.x() * scale, rect.y() * scale, rect.width() * scale, rect.height() * scale).toAlignedRect();
+    };
+    m_lastDamage.append(scaled(geometry.horizontalBand()));
+    m_lastDamage.append(scaled(geometry.verticalBand()));
+}
+
+const XRenderCrosshairRenderer::PointerFill& XRenderCrosshairRenderer::fillFor(int pointerIndex)
+{
+    const QColor pointer = pointerColor(pointerIndex);
+    auto it = m_fills.constFind(pointer.rgba());
+    if (it != m_fills.constEnd()) {
+        return it.value();
+    }
+
+    XRenderColor color = toRenderColor(pointer);
+    XRenderColor inverse = toRenderColor(inverseOf(pointer));
+
+    PointerFill fill;
+    fill.color = XRenderCreateSolidFill(m_display, &color);
+    fill.inverse = XRenderCreateSolidFill(m_display, &inverse);
+    return m_fills.insert(pointer.rgba(), fill).value();
+}
+
+void XRenderCrosshairRenderer::releaseFills()
+{
+    if (!m_display) return;
+
+    for (const PointerFill& fill : std::as_const(m_fills)) {
+        XRenderFreePicture(m_display, fill.color);
+        XRenderFreePicture(m_display, fill.inverse);
+    }
+    m_fills.clear();
+}
+
+void XRenderCrosshairRenderer::clearDamage(unsigned long target)
+{
+    if (m_lastDamage.isEmpty()) return;
+
+    QVector<XRectangle> rects;
+    rects.reserve(m_lastDamage.size());
+    for (const QRect& rect : m_lastDamage) {
+        rects.append(toXRectangle(rect, 1.0));
+    }
+
+    XRenderColor transparent = { 0, 0, 0, 0 };
+    XRenderFillRectangles(m_display, PictOpSrc, target, &transparent, rects.data(), rects.size());
+    m_lastDamage.clear();
+}
+
+const XRenderCrosshairRenderer::Glyph& XRenderCrosshairRenderer::glyphFor(DirectionShape shape, int radius, int arm,
+                                                                          const QPointF& towardsCenter)
+{
+    // The scale is part of the key, the window can move to a screen with another ratio
+    const double scale = devicePixelRatioF();
+    const quint64 key = PrewarmedState::shapeKey(scale, shape, radius, arm);
+    auto it = m_glyphs.constFind(key);
+    if (it != m_glyphs.constEnd()) {
+        return it.value();
+    }
+
+    // Rasterize the shape once on the client unless the prewarm already did
+    const PrewarmedState::ShapeMask* prewarmed = m_prewarmed ? m_prewarmed->shapeMask(scale, shape, radius, arm) : nullptr;
+    const PrewarmedState::ShapeMask mask = prewarmed ? *prewarmed
+                                                     : PrewarmedState::rasterizeShape(shape, radius, towardsCenter, scale);
+    return m_glyphs[key] = uploadGlyph(mask.alpha, mask.origin);
+}
+
+XRenderCrosshairRenderer::Glyph XRenderCrosshairRenderer::uploadGlyph(const QImage& alpha, const QPoint& origin)
+{
+    Glyph glyph;
+    if (alpha.isNull()) return glyph;
+
+    // Kept in the server as an A8 mask
+    Pixmap pixmap = XCreatePixmap(m_display, X11Support::rootWindow(), alpha.width(), alpha.height(), 8);
+    XImage* ximage = XCreateImage(m_display, DefaultVisual(m_display, X11Support::defaultScreen()), 8, ZPixmap, 0,
+                                  const_cast<char*>(reinterpret_cast<const char*>(alpha.constBits())),
+                                  alpha.width(), alpha.height(), 32, alpha.bytesPerLine());
+    if (ximage) {
+        GC gc = XCreateGC(m_display, pixmap, 0, nullptr);
+        XPutImage(m_display, pixmap, gc, ximage, 0, 0, 0, 0, alpha.width(), alpha.height());
+        XFreeGC(m_display, gc);
+        ximage->data = nullptr; // Owned by the QImage
+        XDestroyImage(ximage);
+    }
+
+    glyph.picture = XRenderCreatePicture(m_display, pixmap,
+                                         XRenderFindStandardFormat(m_display, PictStandardA8), 0, nullptr);
+    XFreePixmap(m_display, pixmap);
+
+    glyph.originX = origin.x();
+    glyph.originY = origin.y();
+    glyph.width = alpha.width();
+    glyph.height = alpha.height();
+    return glyph;
+}
+
+void XRenderCrosshairRenderer::adoptPrewarmedState(const std::shared_ptr<const PrewarmedState>& state)
+{
+    CrosshairRenderer::adoptPrewarmedState(state);
+    if (!m_display || !state) return;
+
+    // Glyphs of earlier settings or screens would otherwise pile up in the server
+    for (auto it = m_glyphs.begin(); it != m_glyphs.end();) {
+        if (state->shapeMasks.contains(it.key())) {
+            ++it;
+            continue;
+        }
+        if (it->picture) {
+            XRenderFreePicture(m_display, it->picture);
+        }
+        it = m_glyphs.erase(it);
+    }
+
+    // Upload now, between frames, rather than when a shape first shows up
+    const double scale = devicePixelRatioF();
+    const DirectionShape shape = state->settings.directionShape;
+    for (int radius : state->shapeRadii()) {
+        for (int arm = 0; arm < CrosshairGeometry::ArmCount; ++arm) {
+            const quint64 key = PrewarmedState::shapeKey(scale, shape, radius, arm);
+            if (m_glyphs.contains(key)) continue;
+            if (const PrewarmedState::ShapeMask* mask = state->shapeMask(scale, shape, radius, arm)) {
+                m_glyphs.insert(key, uploadGlyph(mask->alpha, mask->origin));
+            }
+        }
+    }
+    XFlush(m_display);
+}
+
+void XRenderCrosshairRenderer::releaseGlyphs()
+{
+    if (!m_display) return;
+
+    for (const Glyph& glyph : std::as_const(m_glyphs)) {
+        if (glyph.picture) {
+            XRenderFreePicture(m_display, glyph.picture);
+        }
+    }
+    m_glyphs.clear();
+}
+
+int XRenderCrosshairRenderer::getScaledLineWidth() const
+{
+    QScreen *screen = QApplication::screenAt(m_mousePos);
+    if (!screen) {
+        screen = QApplication::primaryScreen();
+    }
+    int scaledWidth = static_cast<int>(m_settings.lineWidth * screen->devicePixelRatio());
+    return qMax(3, scaledWidth);
+}
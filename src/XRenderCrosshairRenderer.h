@@ -0,0 +1,100 @@
+/*
+ * MouseCross - A crosshair overlay application for visually impaired users
+ * Copyright (C) 2025 Stefan Lohmaier <stefan@slohmaier.de>
+ *
+ * This file is part of MouseCross.
+ *
+ * MouseCross is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MouseCross is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with MouseCross. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Project website: https://slohmaier.de/mousecross
+ */
+
+#ifndef XRENDERCROSSHAIRRENDERER_H
+#define XRENDERCROSSHAIRRENDERER_H
+
+#include "CrosshairRenderer.h"
+#include <QWidget>
+#include <QHash>
+#include <QVector>
+
+typedef struct _XDisplay Display;
+
+// X11 renderer that rasterizes the crosshair inside the X server. Arms are sent
+// as XRender trapezoids, closing and center lines as filled rectangles and the
+// direction shapes are composited from glyph Pictures that are uploaded once.
+// Crosshairs of all master pointers share the glyphs and one damage-tracked pass.
+class XRenderCrosshairRenderer : public QWidget, public CrosshairRenderer
+{
+    Q_OBJECT
+
+public:
+    XRenderCrosshairRenderer();
+    ~XRenderCrosshairRenderer() override;
+
+    static bool isSupported();
+
+    bool initialize() override;
+    void cleanup() override;
+
+    void startRendering() override;
+    void stopRendering() override;
+    void parkRendering() override;
+
+    void updateSettings(const Settings& settings) override;
+    void updateMousePosition(const QPoint& pos) override;
+
+    bool isRendering() const override { return m_isRendering; }
+    bool supportsExtraPointers() const override { return true; }
+    void adoptPrewarmedState(const std::shared_ptr<const PrewarmedState>& state) override;
+
+    QPaintEngine* paintEngine() const override { return nullptr; }
+
+protected:
+    void paintEvent(QPaintEvent *event) override;
+
+private:
+    struct Glyph {
+        unsigned long picture = 0;
+        int originX = 0;   // Offset from the shape center to the glyph's top left corner
+        int originY = 0;
+        int width = 0;
+        int height = 0;
+    };
+
+    struct PointerFill {
+        unsigned long color = 0;
+        unsigned long inverse = 0;
+    };
+
+    void setupWindow();
+    void renderFrame();
+    void renderFrame(unsigned long target);
+    void renderCrosshair(unsigned long target, const QPoint& pos, int pointerIndex);
+    void clearDamage(unsigned long target);
+    const PointerFill& fillFor(int pointerIndex);
+    void releaseFills();
+    const Glyph& glyphFor(DirectionShape shape, int radius, int arm, const QPointF& towardsCenter);
+    Glyph uploadGlyph(const QImage& alpha, const QPoint& origin);
+    void releaseGlyphs();
+    int getScaledLineWidth() const;
+
+    Display* m_display;
+    unsigned long m_windowPicture;
+    QHash<QRgb, PointerFill> m_fills;
+    QHash<quint64, Glyph> m_glyphs;
+    QVector<QRect> m_lastDamage;
+    bool m_parked;
+};
+
+#endif // XRENDERCROSSHAIRRENDERER_H
@@ -22,15 +22,56 @@
 
 #include <QApplication>
 #include <QSharedMemory>
-#include <QLocalSocket>
 #include <QMessageBox>
-#include <QTranslator>
-#include <QLocale>
+#include <QElapsedTimer>
+#include <cstdio>
+#include <cstring>
 #include "MouseCrossApp.h"
+#include "StartupProfile.h"
+#include "ControlChannel.h"
 
 int main(int argc, char *argv[])
 {
+    QElapsedTimer launchTimer;
+    launchTimer.start();
+
+    bool benchmark = false;
+    bool timing = false;
+    QStringList command;
+    for (int i = 1; i < argc; ++i) {
+        if (argv[i][0] == '-') {
+            benchmark = benchmark || std::strcmp(argv[i], "--startup-benchmark") == 0;
+            timing = timing || std::strcmp(argv[i], "--timing") == 0;
+        } else {
+            command << QString::fromLocal8Bit(argv[i]);
+        }
+    }
+    
+    // "MouseCross toggle", "MouseCross set crosshair/lineWidth=6" etc. hand the
+    // command to the running instance and exit before any widget is created.
+    // Command names are case insensitive on both ends, setting keys are not.
+    static const QStringList commands = {"toggle", "show", "hide", "set", "get"};
+    if (!command.isEmpty() && commands.contains(command.first(), Qt::CaseInsensitive)) {
+        QCoreApplication client(argc, argv);
+        const qint64 clientReady = launchTimer.nsecsElapsed();
+        QString reply;
+        if (!ControlChannel::send(command.join(' '), &reply)) {
+            std::fprintf(stderr, "MouseCross is not running\n");
+            return 2;
+        }
+        std::printf("%s\n", qPrintable(reply));
+        if (timing) {
+            const qint64 total = launchTimer.nsecsElapsed();
+            std::fprintf(stderr, "client startup %.2f ms, round trip %.2f ms\n",
+                         clientReady / 1e6, (total - clientReady) / 1e6);
+        }
+        return reply.startsWith("ok") ? 0 : 1;
+    }
+    
+    StartupProfile::start(benchmark);
+
     QApplication app(argc, argv);
+    StartupProfile::mark("application");
     
     // Prevent application from quitting when last window is closed
     QApplication::setQuitOnLastWindowClosed(false);
@@ -39,20 +80,10 @@ int main(int argc, char *argv[])
     QCoreApplication::setApplicationName("MouseCross");
     QCoreApplication::setApplicationVersion("0.1.0");
     
-    // Load translations
-    QTranslator translator;
-    const QStringList uiLanguages = QLocale::system().uiLanguages();
-    for (const QString &locale : uiLanguages) {
-        const QString baseName = "mousecross_" + QLocale(locale).name().section('_', 0, 0);
-        if (translator.load(":/translations/" + baseName)) {
-            app.installTranslator(&translator);
-            break;
-        }
-    }
-    
-    // Single instance check using QSharedMemory
+    // Single instance check using QSharedMemory. The benchmark runs next to a
+    // running instance. Commands reach the running instance over the ControlChannel.
     QSharedMemory sharedMemory("MouseCross-SingleInstance-Key");
-    if (!sharedMemory.create(1)) {
+    if (!benchmark && !sharedMemory.create(1)) {
         // Another instance is already running
         if (sharedMemory.attach()) {
             sharedMemory.detach();
@@ -60,6 +91,7 @@ int main(int argc, char *argv[])
         return 0;
     }
     
+    // Translations, the menu, the hotkey and the overlay follow once the tray icon is up
     MouseCrossApp mouseCrossApp;
     
     if (!mouseCrossApp.init()) {
@@ -67,4 +99,4 @@ int main(int argc, char *argv[])
     }
     
     return app.exec();
-}
\ No newline at end of file
+}
@@ -0,0 +1,50 @@
+#!/bin/sh
+# Runs a command inside a headless sway session, the Wayland counterpart of xvfb-run:
+#   tests/run-headless-wayland.sh ./tst_waylandrenderer
+# weston has no layer-shell, so a wlroots compositor is needed.
+
+SWAY=${SWAY:-sway}
+
+runtime_dir=$(mktemp -d) || exit 1
+chmod 700 "$runtime_dir"
+trap 'rm -rf "$runtime_dir"' EXIT
+
+# One headless output, no input devices and no GPU
+cat > "$runtime_dir/config" <<EOF
+output HEADLESS-1 resolution 1280x800
+EOF
+
+export XDG_RUNTIME_DIR="$runtime_dir"
+export WLR_BACKENDS=headless
+export WLR_LIBINPUT_NO_DEVICES=1
+export WLR_RENDERER=pixman
+unset DISPLAY WAYLAND_DISPLAY
+
+"$SWAY" -c "$runtime_dir/config" >"$runtime_dir/sway.log" 2>&1 &
+sway_pid=$!
+
+# Wait up to five seconds for the compositor socket
+socket=
+tries=0
+while [ -z "$socket" ] && [ $tries -lt 50 ]; do
+    for candidate in "$runtime_dir"/wayland-*; do
+        case $candidate in *.lock) continue ;; esac
+        [ -S "$candidate" ] && socket=$(basename "$candidate")
+    done
+    [ -n "$socket" ] || sleep 0.1
+    tries=$((tries + 1))
+done
+
+if [ -z "$socket" ]; then
+    echo "sway did not start:" >&2
+    cat "$runtime_dir/sway.log" >&2
+    kill "$sway_pid" 2>/dev/null
+    exit 1
+fi
+
+WAYLAND_DISPLAY=$socket "$@"
+status=$?
+
+kill "$sway_pid" 2>/dev/null
+wait "$sway_pid" 2>/dev/null
+exit $status
@@ -0,0 +1,196 @@
+/*
+ * MouseCross - A crosshair overlay application for visually impaired users
+ * Copyright (C) 2025 Stefan Lohmaier <stefan@slohmaier.de>
+ *
+ * This file is part of MouseCross.
+ *
+ * MouseCross is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MouseCross is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with MouseCross. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Project website: https://slohmaier.de/mousecross
+ */
+
+#include "FrameScheduler.h"
+#include <QSignalSpy>
+#include <QTest>
+
+namespace {
+
+const qint64 NsPerMs = 1000 * 1000;
+// 60 Hz, as rounded by FrameScheduler
+const qint64 Interval60Hz = 16666667;
+
+// Advanced by hand, so frame targets do not depend on the test machine's timing
+class FakeFrameClock : public FrameClock
+{
+public:
+    qint64 now() const override { return m_now; }
+    void set(qint64 now) { m_now = now; }
+    void advance(qint64 ns) { m_now += ns; }
+
+private:
+    qint64 m_now = 0;
+};
+
+}
+
+class FrameSchedulerTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void init();
+    void cleanup();
+
+    void firstFrameIsImmediate();
+    void requestsAreCoalesced();
+    void framesFollowTheGrid();
+    void frameAlreadyOnTheGridMovesToTheNextRefresh();
+    void idleStartsNewGrid();
+    void cancelStartsNewGrid();
+    void rateCapLimitsInterval();
+    void invalidRefreshRateFallsBackTo60Hz();
+
+private:
+    qint64 nextTarget();
+
+    FakeFrameClock* m_clock = nullptr;
+    FrameScheduler* m_scheduler = nullptr;
+};
+
+void FrameSchedulerTest::init()
+{
+    auto clock = std::make_unique<FakeFrameClock>();
+    m_clock = clock.get();
+    m_clock->set(1000 * NsPerMs);
+    m_scheduler = new FrameScheduler(std::move(clock));
+}
+
+void FrameSchedulerTest::cleanup()
+{
+    delete m_scheduler;
+    m_scheduler = nullptr;
+    m_clock = nullptr;
+}
+
+qint64 FrameSchedulerTest::nextTarget()
+{
+    QSignalSpy spy(m_scheduler, &FrameScheduler::frameDue);
+    if (!spy.wait(200) || spy.count() != 1) return -1;
+    return spy.takeFirst().at(0).toLongLong();
+}
+
+void FrameSchedulerTest::firstFrameIsImmediate()
+{
+    const qint64 start = m_clock->now();
+    m_scheduler->requestFrame();
+    QCOMPARE(nextTarget(), start);
+}
+
+void FrameSchedulerTest::requestsAreCoalesced()
+{
+    QSignalSpy spy(m_scheduler, &FrameScheduler::frameDue);
+    m_scheduler->requestFrame();
+    m_clock->advance(1 * NsPerMs);
+    m_scheduler->requestFrame();
+    m_scheduler->requestFrame();
+
+    QVERIFY(spy.wait(200));
+    QTest::qWait(50);
+    QCOMPARE(spy.count(), 1);
+}
+
+void FrameSchedulerTest::framesFollowTheGrid()
+{
+    const qint64 start = m_clock->now();
+    m_scheduler->requestFrame();
+    QCOMPARE(nextTarget(), start);
+
+    // A request 5 ms after the first frame is meant for the next refresh
+    m_clock->advance(5 * NsPerMs);
+    m_scheduler->requestFrame();
+    QCOMPARE(nextTarget(), start + Interval60Hz);
+
+    // Late requests stay on the grid rather than starting one of their own
+    m_clock->set(start + Interval60Hz + 3 * NsPerMs);
+    m_scheduler->requestFrame();
+    QCOMPARE(nextTarget(), start + 2 * Interval60Hz);
+}
+
+void FrameSchedulerTest::frameAlreadyOnTheGridMovesToTheNextRefresh()
+{
+    const qint64 start = m_clock->now();
+    m_scheduler->requestFrame();
+    QCOMPARE(nextTarget(), start);
+
+    // The refresh at start already had its frame
+    m_scheduler->requestFrame();
+    QCOMPARE(nextTarget(), start + Interval60Hz);
+}
+
+void FrameSchedulerTest::idleStartsNewGrid()
+{
+    m_scheduler->requestFrame();
+    QVERIFY(nextTarget() >= 0);
+
+    // More than two refreshes without a request
+    m_clock->advance(3 * Interval60Hz + 7 * NsPerMs);
+    const qint64 resumed = m_clock->now();
+    m_scheduler->requestFrame();
+    QCOMPARE(nextTarget(), resumed);
+}
+
+void FrameSchedulerTest::cancelStartsNewGrid()
+{
+    QSignalSpy spy(m_scheduler, &FrameScheduler::frameDue);
+    m_scheduler->requestFrame();
+    m_scheduler->cancel();
+    QTest::qWait(50);
+    QCOMPARE(spy.count(), 0);
+
+    m_clock->advance(2 * NsPerMs);
+    const qint64 resumed = m_clock->now();
+    m_scheduler->requestFrame();
+    QVERIFY(spy.wait(200));
+    QCOMPARE(spy.takeFirst().at(0).toLongLong(), resumed);
+}
+
+void FrameSchedulerTest::rateCapLimitsInterval()
+{
+    m_scheduler->setRefreshRate(144.0);
+    m_scheduler->setRateCap(30.0);
+    QCOMPARE(m_scheduler->frameInterval(), qint64(33333333));
+    QCOMPARE(m_scheduler->frameIntervalMs(), 33);
+
+    const qint64 start = m_clock->now();
+    m_scheduler->requestFrame();
+    QCOMPARE(nextTarget(), start);
+    m_clock->advance(1 * NsPerMs);
+    m_scheduler->requestFrame();
+    QCOMPARE(nextTarget(), start + 33333333);
+
+    // A cap above the refresh rate has no effect
+    m_scheduler->setRateCap(240.0);
+    QCOMPARE(m_scheduler->frameInterval(), qint64(6944444));
+}
+
+void FrameSchedulerTest::invalidRefreshRateFallsBackTo60Hz()
+{
+    m_scheduler->setRefreshRate(0.0);
+    QCOMPARE(m_scheduler->refreshRate(), 60.0);
+    QCOMPARE(m_scheduler->frameInterval(), Interval60Hz);
+    QCOMPARE(m_scheduler->frameIntervalMs(), 17);
+}
+
+QTEST_GUILESS_MAIN(FrameSchedulerTest)
+#include "tst_framescheduler.moc"
@@ -0,0 +1,166 @@
+/*
+ * MouseCross - A crosshair overlay application for visually impaired users
+ * Copyright (C) 2025 Stefan Lohmaier <stefan@slohmaier.de>
+ *
+ * This file is part of MouseCross.
+ *
+ * MouseCross is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MouseCross is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with MouseCross. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Project website: https://slohmaier.de/mousecross
+ */
+
+#include "JitterFilter.h"
+#include <QTest>
+
+namespace {
+
+const qint64 NsPerMs = 1000 * 1000;
+// 125 Hz, a common mouse report rate
+const qint64 SampleInterval = 8 * NsPerMs;
+
+CursorSample sampleAt(const QPoint& pos, qint64 timestamp)
+{
+    CursorSample sample;
+    sample.pos = pos;
+    sample.timestamp = timestamp;
+    return sample;
+}
+
+}
+
+class JitterFilterTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void deadZoneSuppressesSmallMoves();
+    void zeroDeadZoneRepaintsEveryMove();
+    void disabledRepaintsEveryMove();
+    void negativeDeadZoneIsClamped();
+    void firstSamplePassesUnchanged();
+    void tremorStaysInsideDeadZone();
+    void fastMoveLagsLessThanOneStep();
+    void restResetsFilter();
+};
+
+void JitterFilterTest::deadZoneSuppressesSmallMoves()
+{
+    JitterFilter filter;
+    filter.setDeadZone(3);
+    const QPoint shown(500, 400);
+
+    QVERIFY(!filter.exceedsDeadZone(shown, shown));
+    QVERIFY(!filter.exceedsDeadZone(shown, shown + QPoint(2, 0)));
+    // Distance, not per axis: 2.8 px stays inside a 3 px zone
+    QVERIFY(!filter.exceedsDeadZone(shown, shown + QPoint(2, -2)));
+    QVERIFY(filter.exceedsDeadZone(shown, shown + QPoint(3, 0)));
+    QVERIFY(filter.exceedsDeadZone(shown, shown + QPoint(0, -3)));
+    QVERIFY(filter.exceedsDeadZone(shown, shown + QPoint(-3, 3)));
+}
+
+void JitterFilterTest::zeroDeadZoneRepaintsEveryMove()
+{
+    JitterFilter filter;
+    filter.setDeadZone(0);
+    const QPoint shown(500, 400);
+
+    QVERIFY(!filter.exceedsDeadZone(shown, shown));
+    QVERIFY(filter.exceedsDeadZone(shown, shown + QPoint(1, 0)));
+}
+
+void JitterFilterTest::disabledRepaintsEveryMove()
+{
+    JitterFilter filter;
+    filter.setDeadZone(8);
+    filter.setEnabled(false);
+    const QPoint shown(500, 400);
+
+    QVERIFY(!filter.exceedsDeadZone(shown, shown));
+    QVERIFY(filter.exceedsDeadZone(shown, shown + QPoint(1, 0)));
+
+    // Samples pass through untouched
+    CursorSample first = sampleAt(QPoint(100, 100), 1000 * NsPerMs);
+    filter.filter(first);
+    CursorSample second = sampleAt(QPoint(103, 98), 1000 * NsPerMs + SampleInterval);
+    filter.filter(second);
+    QCOMPARE(second.pos, QPoint(103, 98));
+}
+
+void JitterFilterTest::negativeDeadZoneIsClamped()
+{
+    JitterFilter filter;
+    filter.setDeadZone(-5);
+    QCOMPARE(filter.deadZone(), 0);
+}
+
+void JitterFilterTest::firstSamplePassesUnchanged()
+{
+    JitterFilter filter;
+    CursorSample sample = sampleAt(QPoint(321, 123), 1000 * NsPerMs);
+    filter.filter(sample);
+    QCOMPARE(sample.pos, QPoint(321, 123));
+}
+
+void JitterFilterTest::tremorStaysInsideDeadZone()
+{
+    JitterFilter filter;
+    filter.setDeadZone(2);
+    const QPoint rest(100, 200);
+
+    // Shaking 2 px back and forth on both axes is smoothed to within a pixel of the rest position
+    qint64 timestamp = 1000 * NsPerMs;
+    for (int i = 0; i < 40; ++i) {
+        const int swing = (i % 2) ? 2 : 0;
+        CursorSample sample = sampleAt(rest + QPoint(swing, -swing), timestamp);
+        filter.filter(sample);
+        QVERIFY2(!filter.exceedsDeadZone(rest, sample.pos), qPrintable(QString::number(i)));
+        timestamp += SampleInterval;
+    }
+}
+
+void JitterFilterTest::fastMoveLagsLessThanOneStep()
+{
+    JitterFilter filter;
+
+    // 1000 px/s to the right
+    const int step = 8;
+    qint64 timestamp = 1000 * NsPerMs;
+    CursorSample sample;
+    QPoint raw;
+    for (int i = 0; i <= 30; ++i) {
+        raw = QPoint(100 + step * i, 300);
+        sample = sampleAt(raw, timestamp);
+        filter.filter(sample);
+        timestamp += SampleInterval;
+    }
+
+    QCOMPARE(sample.pos.y(), 300);
+    QVERIFY(sample.pos.x() <= raw.x());
+    QVERIFY(raw.x() - sample.pos.x() < step);
+}
+
+void JitterFilterTest::restResetsFilter()
+{
+    JitterFilter filter;
+    CursorSample first = sampleAt(QPoint(100, 100), 1000 * NsPerMs);
+    filter.filter(first);
+
+    // After a second at rest the old state is stale, the new position is taken as is
+    CursorSample resumed = sampleAt(QPoint(600, 450), 2000 * NsPerMs);
+    filter.filter(resumed);
+    QCOMPARE(resumed.pos, QPoint(600, 450));
+}
+
+QTEST_APPLESS_MAIN(JitterFilterTest)
+#include "tst_jitterfilter.moc"
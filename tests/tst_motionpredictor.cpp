@@ -0,0 +1,148 @@
+/*
+ * MouseCross - A crosshair overlay application for visually impaired users
+ * Copyright (C) 2025 Stefan Lohmaier <stefan@slohmaier.de>
+ *
+ * This file is part of MouseCross.
+ *
+ * MouseCross is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MouseCross is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with MouseCross. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Project website: https://slohmaier.de/mousecross
+ */
+
+#include "MotionPredictor.h"
+#include <QTest>
+
+namespace {
+
+const qint64 NsPerMs = 1000 * 1000;
+const QPoint Pos(400, 300);
+
+CursorSample sampleWith(const QPointF& velocity)
+{
+    CursorSample sample;
+    sample.pos = Pos;
+    sample.velocity = velocity;
+    return sample;
+}
+
+}
+
+class MotionPredictorTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void init();
+
+    void disabledReturnsPosition();
+    void slowMovementIsNotPredicted();
+    void extrapolatesOverHorizon();
+    void horizonIsCapped();
+    void offsetIsCapped();
+    void reversalPausesPrediction();
+    void gentleTurnKeepsPredicting();
+    void slowSampleEndsPause();
+    void latencyIsSmoothed();
+
+private:
+    MotionPredictor m_predictor;
+};
+
+void MotionPredictorTest::init()
+{
+    m_predictor = MotionPredictor();
+    m_predictor.setEnabled(true);
+}
+
+void MotionPredictorTest::disabledReturnsPosition()
+{
+    m_predictor.setEnabled(false);
+    QCOMPARE(m_predictor.predict(sampleWith(QPointF(1000, 0)), 20 * NsPerMs), Pos);
+}
+
+void MotionPredictorTest::slowMovementIsNotPredicted()
+{
+    // Precise positioning below 200 px/s is shown as is
+    QCOMPARE(m_predictor.predict(sampleWith(QPointF(150, 0)), 20 * NsPerMs), Pos);
+    QCOMPARE(m_predictor.predict(sampleWith(QPointF(0, -150)), 20 * NsPerMs), Pos);
+}
+
+void MotionPredictorTest::extrapolatesOverHorizon()
+{
+    QCOMPARE(m_predictor.predict(sampleWith(QPointF(1000, 0)), 20 * NsPerMs), Pos + QPoint(20, 0));
+    QCOMPARE(m_predictor.predict(sampleWith(QPointF(0, -1000)), 10 * NsPerMs), Pos + QPoint(0, -10));
+}
+
+void MotionPredictorTest::horizonIsCapped()
+{
+    // Look-ahead stops at 50 ms however late the frame is expected
+    QCOMPARE(m_predictor.predict(sampleWith(QPointF(1000, 0)), 200 * NsPerMs), Pos + QPoint(50, 0));
+}
+
+void MotionPredictorTest::offsetIsCapped()
+{
+    // 5000 px/s over 20 ms would be 100 px, the offset stops at 64
+    QCOMPARE(m_predictor.predict(sampleWith(QPointF(5000, 0)), 20 * NsPerMs), Pos + QPoint(64, 0));
+}
+
+void MotionPredictorTest::reversalPausesPrediction()
+{
+    const qint64 horizon = 20 * NsPerMs;
+    QCOMPARE(m_predictor.predict(sampleWith(QPointF(1000, 0)), horizon), Pos + QPoint(20, 0));
+
+    // The turn and the two frames after it show the real position
+    for (int i = 0; i < 3; ++i) {
+        QCOMPARE(m_predictor.predict(sampleWith(QPointF(-1000, 0)), horizon), Pos);
+    }
+    QCOMPARE(m_predictor.predict(sampleWith(QPointF(-1000, 0)), horizon), Pos + QPoint(-20, 0));
+}
+
+void MotionPredictorTest::gentleTurnKeepsPredicting()
+{
+    const qint64 horizon = 20 * NsPerMs;
+    m_predictor.predict(sampleWith(QPointF(1000, 0)), horizon);
+
+    // About 27 degrees, well below the 60 degree limit
+    QCOMPARE(m_predictor.predict(sampleWith(QPointF(1000, 500)), horizon), Pos + QPoint(20, 10));
+}
+
+void MotionPredictorTest::slowSampleEndsPause()
+{
+    const qint64 horizon = 20 * NsPerMs;
+    m_predictor.predict(sampleWith(QPointF(1000, 0)), horizon);
+    QCOMPARE(m_predictor.predict(sampleWith(QPointF(-1000, 0)), horizon), Pos);
+
+    // Slowing down ends the pause, the next fast sample is predicted again
+    QCOMPARE(m_predictor.predict(sampleWith(QPointF(-50, 0)), horizon), Pos);
+    QCOMPARE(m_predictor.predict(sampleWith(QPointF(-1000, 0)), horizon), Pos + QPoint(-20, 0));
+}
+
+void MotionPredictorTest::latencyIsSmoothed()
+{
+    QCOMPARE(m_predictor.latency(), qint64(0));
+    m_predictor.addLatencySample(8 * NsPerMs);
+    QCOMPARE(m_predictor.latency(), 8 * NsPerMs);
+
+    // One eighth of the difference per sample
+    m_predictor.addLatencySample(16 * NsPerMs);
+    QCOMPARE(m_predictor.latency(), 9 * NsPerMs);
+
+    // Outliers beyond the horizon cap and bogus values are ignored
+    m_predictor.addLatencySample(500 * NsPerMs);
+    m_predictor.addLatencySample(0);
+    QCOMPARE(m_predictor.latency(), 9 * NsPerMs);
+}
+
+QTEST_APPLESS_MAIN(MotionPredictorTest)
+#include "tst_motionpredictor.moc"
@@ -0,0 +1,205 @@
+/*
+ * MouseCross - A crosshair overlay application for visually impaired users
+ * Copyright (C) 2025 Stefan Lohmaier <stefan@slohmaier.de>
+ *
+ * This file is part of MouseCross.
+ *
+ * MouseCross is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MouseCross is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with MouseCross. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Project website: https://slohmaier.de/mousecross
+ */
+
+#include "QualityGovernor.h"
+#include "RenderCostModel.h"
+#include <QTest>
+
+namespace {
+
+// 60 Hz
+const qint64 Budget = 16666667;
+const QRect Desktop(0, 0, 3840, 2160);
+const int BaseThickness = 6;
+
+qint64 share(double fraction)
+{
+    return qint64(Budget * fraction);
+}
+
+}
+
+class QualityGovernorTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void init();
+
+    void costCountsTaperStepsOnlyWhenStroked();
+    void disabledKeepsFullQuality();
+    void singleSlowFrameIsNoise();
+    void stepsToFirstLevelPredictedToFit();
+    void stopsAtLowestUsefulLevel_data();
+    void stopsAtLowestUsefulLevel();
+    void stepsUpAfterSustainedHeadroom();
+    void overrunRestartsHeadroom();
+    void workloadWithoutTaperLeavesCoarseTaper();
+
+private:
+    // Overruns until the governor steps down, false if it never does
+    bool overrun(qint64 frameTime);
+
+    // No direction shapes: dropping antialiasing is then the only cheaper
+    // level before the taper, at exactly two thirds of the cost
+    CrosshairRenderer::Settings m_settings;
+    QualityGovernor m_governor;
+};
+
+void QualityGovernorTest::init()
+{
+    m_settings = CrosshairRenderer::Settings();
+    m_settings.showArrows = false;
+    m_governor = QualityGovernor();
+    m_governor.setWorkload(m_settings, Desktop, BaseThickness, true);
+}
+
+bool QualityGovernorTest::overrun(qint64 frameTime)
+{
+    for (int i = 0; i < 100; ++i) {
+        if (m_governor.addFrame(frameTime, Budget)) return true;
+    }
+    return false;
+}
+
+void QualityGovernorTest::costCountsTaperStepsOnlyWhenStroked()
+{
+    // Four arms of 50 steps, each stroked twice for the contrast line, plus two per arm
+    const RenderCost stroked = RenderCost::estimate(m_settings, Desktop, BaseThickness, true);
+    QCOMPARE(stroked.primitives, 4 * (50 * 2 + 2));
+
+    const RenderCost filled = RenderCost::estimate(m_settings, Desktop, BaseThickness, false);
+    QCOMPARE(filled.primitives, 4 * (2 + 2));
+    QCOMPARE(filled.pixels, stroked.pixels);
+
+    // Solid arms have no taper on any backend
+    m_settings.solidArms = true;
+    QCOMPARE(RenderCost::estimate(m_settings, Desktop, BaseThickness, true).primitives,
+             RenderCost::estimate(m_settings, Desktop, BaseThickness, false).primitives);
+}
+
+void QualityGovernorTest::disabledKeepsFullQuality()
+{
+    m_governor.setEnabled(false);
+    QVERIFY(!overrun(share(2.0)));
+    QCOMPARE(m_governor.level(), QualityGovernor::Full);
+}
+
+void QualityGovernorTest::singleSlowFrameIsNoise()
+{
+    // Seven overruns in a row are tolerated, a good frame starts the count again
+    for (int i = 0; i < 7; ++i) {
+        QVERIFY(!m_governor.addFrame(share(0.9), Budget));
+    }
+    QVERIFY(!m_governor.addFrame(share(0.5), Budget));
+    for (int i = 0; i < 7; ++i) {
+        QVERIFY(!m_governor.addFrame(share(0.9), Budget));
+    }
+    QCOMPARE(m_governor.level(), QualityGovernor::Full);
+
+    QVERIFY(m_governor.addFrame(share(0.9), Budget));
+    QCOMPARE(m_governor.level(), QualityGovernor::NoAntialiasing);
+}
+
+void QualityGovernorTest::stepsToFirstLevelPredictedToFit()
+{
+    // Two thirds of 0.85 fits into the 0.8 share, one step is enough
+    QVERIFY(overrun(share(0.85)));
+    QCOMPARE(m_governor.level(), QualityGovernor::NoAntialiasing);
+
+    const CrosshairRenderer::Settings applied = m_governor.apply(m_settings);
+    QVERIFY(!applied.antialiasing);
+    QCOMPARE(applied.taperSegments, m_settings.taperSegments);
+}
+
+void QualityGovernorTest::stopsAtLowestUsefulLevel_data()
+{
+    QTest::addColumn<bool>("taperSegments");
+    QTest::addColumn<int>("lowest");
+
+    QTest::newRow("stroked taper") << true << int(QualityGovernor::CoarseTaper);
+    QTest::newRow("filled arms") << false << int(QualityGovernor::FewerShapes);
+}
+
+void QualityGovernorTest::stopsAtLowestUsefulLevel()
+{
+    QFETCH(bool, taperSegments);
+    QFETCH(int, lowest);
+
+    // Nothing is predicted to fit, so the governor goes straight to the last level
+    // that saves work on this backend and stays there
+    m_governor.setWorkload(m_settings, Desktop, BaseThickness, taperSegments);
+    QVERIFY(overrun(share(2.0)));
+    QCOMPARE(int(m_governor.level()), lowest);
+    QVERIFY(!overrun(share(2.0)));
+    QCOMPARE(int(m_governor.level()), lowest);
+}
+
+void QualityGovernorTest::stepsUpAfterSustainedHeadroom()
+{
+    QVERIFY(overrun(share(0.85)));
+    QCOMPARE(m_governor.level(), QualityGovernor::NoAntialiasing);
+
+    // Light frames, full quality is soon predicted to fit in half the budget,
+    // but the governor waits about two seconds before stepping up
+    for (int i = 0; i < 100; ++i) {
+        QVERIFY(!m_governor.addFrame(share(0.2), Budget));
+    }
+    QCOMPARE(m_governor.level(), QualityGovernor::NoAntialiasing);
+
+    bool steppedUp = false;
+    for (int i = 0; i < 100 && !steppedUp; ++i) {
+        steppedUp = m_governor.addFrame(share(0.2), Budget);
+    }
+    QVERIFY(steppedUp);
+    QCOMPARE(m_governor.level(), QualityGovernor::Full);
+}
+
+void QualityGovernorTest::overrunRestartsHeadroom()
+{
+    QVERIFY(overrun(share(0.85)));
+    for (int i = 0; i < 100; ++i) {
+        m_governor.addFrame(share(0.2), Budget);
+    }
+
+    // One overrun does not step down but the 120 frames of headroom start over
+    QVERIFY(!m_governor.addFrame(share(0.85), Budget));
+    for (int i = 0; i < 119; ++i) {
+        QVERIFY(!m_governor.addFrame(share(0.2), Budget));
+    }
+    QCOMPARE(m_governor.level(), QualityGovernor::NoAntialiasing);
+    QVERIFY(m_governor.addFrame(share(0.2), Budget));
+    QCOMPARE(m_governor.level(), QualityGovernor::Full);
+}
+
+void QualityGovernorTest::workloadWithoutTaperLeavesCoarseTaper()
+{
+    QVERIFY(overrun(share(2.0)));
+    QCOMPARE(m_governor.level(), QualityGovernor::CoarseTaper);
+
+    // Switching to a backend that fills its arms drops the level that saves nothing there
+    m_governor.setWorkload(m_settings, Desktop, BaseThickness, false);
+    QCOMPARE(m_governor.level(), QualityGovernor::FewerShapes);
+}
+
+QTEST_APPLESS_MAIN(QualityGovernorTest)
+#include "tst_qualitygovernor.moc"
@@ -0,0 +1,180 @@
+/*
+ * MouseCross - A crosshair overlay application for visually impaired users
+ * Copyright (C) 2025 Stefan Lohmaier <stefan@slohmaier.de>
+ *
+ * This file is part of MouseCross.
+ *
+ * MouseCross is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MouseCross is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with MouseCross. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Project website: https://slohmaier.de/mousecross
+ */
+
+#include "SettingsManager.h"
+#include <QSettings>
+#include <QSignalSpy>
+#include <QStandardPaths>
+#include <QTest>
+
+class SettingsManagerTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void init();
+    void cleanupTestCase();
+
+    void setValuesAppliesBatch();
+    void unknownKeyRejectsBatch();
+    void invalidValueRejectsBatch_data();
+    void invalidValueRejectsBatch();
+    void rangesMatchSetters();
+    void bookkeepingIsNotControllable();
+    void backendMustBeSelectable();
+};
+
+void SettingsManagerTest::initTestCase()
+{
+    // Keeps the user's real settings file out of reach
+    QStandardPaths::setTestModeEnabled(true);
+}
+
+void SettingsManagerTest::init()
+{
+    QSettings("MouseCross", "MouseCross").clear();
+}
+
+void SettingsManagerTest::cleanupTestCase()
+{
+    QSettings("MouseCross", "MouseCross").clear();
+}
+
+void SettingsManagerTest::setValuesAppliesBatch()
+{
+    SettingsManager settings;
+    QSignalSpy changed(&settings, &SettingsManager::settingsChanged);
+
+    QMap<QString, QString> values;
+    values.insert(QStringLiteral("crosshair/lineWidth"), QStringLiteral("6"));
+    values.insert(QStringLiteral("crosshair/color"), QStringLiteral("#00ff00"));
+    values.insert(QStringLiteral("crosshair/showArrows"), QStringLiteral("off"));
+    QString error;
+    QVERIFY(settings.setValues(values, &error));
+    QVERIFY(error.isEmpty());
+
+    QCOMPARE(settings.crosshairLineWidth(), 6);
+    QCOMPARE(settings.crosshairColor(), QColor(0, 255, 0));
+    QCOMPARE(settings.showArrows(), false);
+    // One notification for the whole batch
+    QCOMPARE(changed.count(), 1);
+}
+
+void SettingsManagerTest::unknownKeyRejectsBatch()
+{
+    SettingsManager settings;
+    const int lineWidth = settings.crosshairLineWidth();
+    QSignalSpy changed(&settings, &SettingsManager::settingsChanged);
+
+    QMap<QString, QString> values;
+    values.insert(QStringLiteral("crosshair/lineWidth"), QString::number(lineWidth + 1));
+    values.insert(QStringLiteral("crosshair/sparkle"), QStringLiteral("1"));
+    QString error;
+    QVERIFY(!settings.setValues(values, &error));
+    QVERIFY(error.contains(QLatin1String("crosshair/sparkle")));
+
+    QCOMPARE(settings.crosshairLineWidth(), lineWidth);
+    QCOMPARE(changed.count(), 0);
+}
+
+void SettingsManagerTest::invalidValueRejectsBatch_data()
+{
+    QTest::addColumn<QString>("key");
+    QTest::addColumn<QString>("value");
+
+    QTest::newRow("int above range") << "crosshair/lineWidth" << "11";
+    QTest::newRow("int below range") << "crosshair/lineWidth" << "2";
+    QTest::newRow("not a number") << "crosshair/offsetFromCursor" << "far";
+    QTest::newRow("double above range") << "crosshair/opacity" << "1.5";
+    QTest::newRow("bool") << "crosshair/showArrows" << "maybe";
+    QTest::newRow("color") << "crosshair/color" << "#12";
+    QTest::newRow("key sequence") << "hotkey/toggle" << "";
+    QTest::newRow("dead zone above setter clamp") << "cursor/jitterDeadZone" << "17";
+}
+
+void SettingsManagerTest::invalidValueRejectsBatch()
+{
+    QFETCH(QString, key);
+    QFETCH(QString, value);
+
+    SettingsManager settings;
+    const QVariant before = settings.value(key);
+    const double opacity = settings.crosshairOpacity();
+    QSignalSpy changed(&settings, &SettingsManager::settingsChanged);
+
+    // A valid value in the same batch is not applied either
+    const bool opacityRow = key == QLatin1String("crosshair/opacity");
+    QMap<QString, QString> values;
+    values.insert(key, value);
+    values.insert(opacityRow ? "crosshair/lineWidth" : "crosshair/opacity", opacityRow ? "5" : "0.3");
+    QString error;
+    QVERIFY(!settings.setValues(values, &error));
+    QVERIFY(error.contains(key));
+
+    QCOMPARE(settings.value(key), before);
+    QCOMPARE(settings.crosshairOpacity(), opacity);
+    QCOMPARE(changed.count(), 0);
+}
+
+void SettingsManagerTest::rangesMatchSetters()
+{
+    // The largest value the control channel accepts is kept as is
+    SettingsManager settings;
+    QMap<QString, QString> values;
+    values.insert(QStringLiteral("cursor/jitterDeadZone"), QStringLiteral("16"));
+    values.insert(QStringLiteral("crosshair/lineWidth"), QStringLiteral("10"));
+    QVERIFY(settings.setValues(values));
+    QCOMPARE(settings.jitterDeadZone(), 16);
+    QCOMPARE(settings.crosshairLineWidth(), 10);
+}
+
+void SettingsManagerTest::bookkeepingIsNotControllable()
+{
+    SettingsManager settings;
+    QVERIFY(settings.isControllable(QStringLiteral("crosshair/lineWidth")));
+    QVERIFY(!settings.isControllable(QStringLiteral("firstRun")));
+    QVERIFY(!settings.isControllable(QStringLiteral("renderer/benchmarked")));
+    QVERIFY(!settings.value(QStringLiteral("firstRun")).isValid());
+
+    QMap<QString, QString> values;
+    values.insert(QStringLiteral("renderer/benchmarked"), QStringLiteral("qt"));
+    QVERIFY(!settings.setValues(values));
+}
+
+void SettingsManagerTest::backendMustBeSelectable()
+{
+    SettingsManager settings;
+    QMap<QString, QString> values;
+
+    values.insert(QStringLiteral("renderer/backend"), QStringLiteral("auto"));
+    QVERIFY(settings.setValues(values));
+    values.insert(QStringLiteral("renderer/backend"), QStringLiteral("no-such-backend"));
+    QVERIFY(!settings.setValues(values));
+    // Experimental even where it is built, only reachable through MOUSECROSS_RENDERER
+    values.insert(QStringLiteral("renderer/backend"), QStringLiteral("wayland"));
+    QVERIFY(!settings.setValues(values));
+    QCOMPARE(settings.rendererBackend(), QStringLiteral("auto"));
+}
+
+QTEST_GUILESS_MAIN(SettingsManagerTest)
+#include "tst_settingsmanager.moc"
@@ -0,0 +1,160 @@
+/*
+ * MouseCross - A crosshair overlay application for visually impaired users
+ * Copyright (C) 2025 Stefan Lohmaier <stefan@slohmaier.de>
+ *
+ * This file is part of MouseCross.
+ *
+ * MouseCross is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MouseCross is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with MouseCross. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Project website: https://slohmaier.de/mousecross
+ */
+
+#include "ShakeDetector.h"
+#include <QTest>
+
+namespace {
+
+const qint64 NsPerMs = 1000 * 1000;
+
+}
+
+class ShakeDetectorTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void init();
+
+    void threeReversalsAreAShake();
+    void verticalShakeCounts();
+    void smallSwingsDoNotCount();
+    void slowShakeFallsOutOfWindow();
+    void oldReversalsExpire();
+    void shakeIsReportedOnce();
+    void resetForgetsReversals();
+    void ringBufferWraps();
+
+private:
+    // Feeds a sample step ms after the previous one, returns addSample()
+    bool move(int x, int y, int stepMs = 100);
+
+    ShakeDetector m_detector;
+    qint64 m_time = 0;
+};
+
+void ShakeDetectorTest::init()
+{
+    m_detector.reset();
+    m_time = 1000 * NsPerMs;
+}
+
+bool ShakeDetectorTest::move(int x, int y, int stepMs)
+{
+    m_time += stepMs * NsPerMs;
+    return m_detector.addSample(QPoint(x, y), m_time);
+}
+
+void ShakeDetectorTest::threeReversalsAreAShake()
+{
+    QVERIFY(!move(100, 300));
+    QVERIFY(!move(160, 300));
+    QVERIFY(!move(100, 300));   // First reversal
+    QVERIFY(!move(160, 300));   // Second
+    QVERIFY(move(100, 300));    // Third completes the shake
+}
+
+void ShakeDetectorTest::verticalShakeCounts()
+{
+    QVERIFY(!move(300, 100));
+    QVERIFY(!move(300, 160));
+    QVERIFY(!move(300, 100));
+    QVERIFY(!move(300, 160));
+    QVERIFY(move(300, 100));
+}
+
+void ShakeDetectorTest::smallSwingsDoNotCount()
+{
+    // Swings below 40 px are ordinary pointing corrections
+    for (int i = 0; i < 10; ++i) {
+        QVERIFY(!move(i % 2 ? 130 : 100, 300));
+    }
+}
+
+void ShakeDetectorTest::slowShakeFallsOutOfWindow()
+{
+    // The same swings 400 ms apart never fit three reversals into 800 ms
+    for (int i = 0; i < 10; ++i) {
+        QVERIFY(!move(i % 2 ? 160 : 100, 300, 400));
+    }
+}
+
+void ShakeDetectorTest::oldReversalsExpire()
+{
+    QVERIFY(!move(100, 300));
+    QVERIFY(!move(160, 300));
+    QVERIFY(!move(100, 300));
+    QVERIFY(!move(160, 300));
+
+    // After a pause only the swings since then are in the window
+    QVERIFY(!move(100, 300, 1000));
+    QVERIFY(!move(160, 300));
+    QVERIFY(!move(100, 300));
+    QVERIFY(!move(160, 300));
+    QVERIFY(move(100, 300));
+}
+
+void ShakeDetectorTest::shakeIsReportedOnce()
+{
+    move(100, 300);
+    move(160, 300);
+    move(100, 300);
+    move(160, 300);
+    QVERIFY(move(100, 300));
+
+    // Continuing to shake needs three new reversals
+    QVERIFY(!move(160, 300));
+    QVERIFY(!move(100, 300));
+    QVERIFY(!move(160, 300));
+    QVERIFY(!move(100, 300));
+    QVERIFY(move(160, 300));
+}
+
+void ShakeDetectorTest::resetForgetsReversals()
+{
+    move(100, 300);
+    move(160, 300);
+    move(100, 300);
+    move(160, 300);
+    m_detector.reset();
+
+    QVERIFY(!move(100, 300));
+    QVERIFY(!move(160, 300));
+    QVERIFY(!move(100, 300));
+}
+
+void ShakeDetectorTest::ringBufferWraps()
+{
+    // More samples than the ring holds, a slow steady drag
+    for (int i = 0; i < 300; ++i) {
+        QVERIFY(!move(i, 300, 8));
+    }
+
+    QVERIFY(!move(400, 300));
+    QVERIFY(!move(340, 300));
+    QVERIFY(!move(400, 300));
+    QVERIFY(move(340, 300));
+}
+
+QTEST_APPLESS_MAIN(ShakeDetectorTest)
+#include "tst_shakedetector.moc"
@@ -0,0 +1,159 @@
+/*
+ * MouseCross - A crosshair overlay application for visually impaired users
+ * Copyright (C) 2025 Stefan Lohmaier <stefan@slohmaier.de>
+ *
+ * This file is part of MouseCross.
+ *
+ * MouseCross is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MouseCross is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with MouseCross. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Project website: https://slohmaier.de/mousecross
+ */
+
+#include "WaylandCrosshairRenderer.h"
+#include <QApplication>
+#include <QTest>
+
+namespace {
+
+const QPoint FirstPos(300, 250);
+const QPoint SecondPos(500, 400);
+// Moved sideways, the vertical arms keep their length and only reposition
+const QPoint ShiftedPos(SecondPos + QPoint(4, 0));
+
+}
+
+class WaylandRendererTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void init();
+    void cleanup();
+
+    void startMapsOverlay();
+    void movesPresentFrames();
+    void settingsChangePresentsFrame();
+    void stopReleasesSurfaces();
+    void restartAfterStop();
+
+private:
+    CrosshairRenderer::Settings m_settings;
+    WaylandCrosshairRenderer* m_renderer = nullptr;
+    int m_presented = 0;
+};
+
+void WaylandRendererTest::initTestCase()
+{
+    if (!WaylandCrosshairRenderer::isSupported()) {
+        QSKIP("Needs a layer-shell compositor, run under tests/run-headless-wayland.sh");
+    }
+
+    m_settings.color = Qt::red;
+    m_settings.lineWidth = 6;
+    m_settings.offsetFromCursor = 20;
+}
+
+void WaylandRendererTest::init()
+{
+    m_presented = 0;
+    m_renderer = new WaylandCrosshairRenderer();
+    QVERIFY(m_renderer->initialize());
+    m_renderer->updateSettings(m_settings);
+    m_renderer->setFramePresentedCallback([this]() { ++m_presented; });
+}
+
+void WaylandRendererTest::cleanup()
+{
+    delete m_renderer;
+    m_renderer = nullptr;
+}
+
+void WaylandRendererTest::startMapsOverlay()
+{
+    m_renderer->startRendering();
+    QVERIFY(m_renderer->isRendering());
+    // The first frame is presented as soon as the layer surface is configured
+    QCOMPARE(m_presented, 1);
+
+    m_renderer->syncDisplay();
+    QVERIFY(m_renderer->isConnected());
+}
+
+void WaylandRendererTest::movesPresentFrames()
+{
+    m_renderer->startRendering();
+    QVERIFY(m_renderer->isRendering());
+    m_presented = 0;
+
+    m_renderer->updateMousePosition(FirstPos);
+    m_renderer->updateMousePosition(SecondPos);
+    m_renderer->updateMousePosition(ShiftedPos);
+    QCOMPARE(m_presented, 3);
+
+    // Buffers, subsurface positions and commits were all accepted
+    m_renderer->syncDisplay();
+    QVERIFY(m_renderer->isConnected());
+    QVERIFY(m_renderer->isRendering());
+}
+
+void WaylandRendererTest::settingsChangePresentsFrame()
+{
+    m_renderer->startRendering();
+    m_renderer->updateMousePosition(FirstPos);
+    m_presented = 0;
+
+    CrosshairRenderer::Settings settings = m_settings;
+    settings.lineWidth = 12;
+    settings.showArrows = false;
+    m_renderer->updateSettings(settings);
+    QCOMPARE(m_presented, 1);
+
+    m_renderer->syncDisplay();
+    QVERIFY(m_renderer->isConnected());
+}
+
+void WaylandRendererTest::stopReleasesSurfaces()
+{
+    m_renderer->startRendering();
+    m_renderer->updateMousePosition(FirstPos);
+    m_renderer->stopRendering();
+    QVERIFY(!m_renderer->isRendering());
+
+    // Destroying surfaces with buffers still attached must not be a protocol error
+    m_renderer->syncDisplay();
+    QVERIFY(m_renderer->isConnected());
+
+    m_presented = 0;
+    m_renderer->updateMousePosition(SecondPos);
+    QCOMPARE(m_presented, 0);
+}
+
+void WaylandRendererTest::restartAfterStop()
+{
+    m_renderer->startRendering();
+    m_renderer->stopRendering();
+    m_presented = 0;
+
+    m_renderer->startRendering();
+    QVERIFY(m_renderer->isRendering());
+    m_renderer->updateMousePosition(SecondPos);
+    QCOMPARE(m_presented, 2);
+
+    m_renderer->syncDisplay();
+    QVERIFY(m_renderer->isConnected());
+}
+
+QTEST_MAIN(WaylandRendererTest)
+#include "tst_waylandrenderer.moc"
@@ -0,0 +1,194 @@
+/*
+ * MouseCross - A crosshair overlay application for visually impaired users
+ * Copyright (C) 2025 Stefan Lohmaier <stefan@slohmaier.de>
+ *
+ * This file is part of MouseCross.
+ *
+ * MouseCross is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MouseCross is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with MouseCross. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Project website: https://slohmaier.de/mousecross
+ */
+
+#include "X11XorCrosshairRenderer.h"
+#include "X11Support.h"
+#include <QApplication>
+#include <QTest>
+#include <cstring>
+
+#include <X11/Xlib.h>
+#include <X11/Xutil.h>
+
+namespace {
+
+// Far enough from the screen edges and from each other that the arms of both
+// positions only cross at right angles
+const QPoint FirstPos(300, 250);
+const QPoint SecondPos(700, 500);
+
+// RAII wrapper for a full grab of the root window
+class RootImage
+{
+public:
+    RootImage()
+    {
+        Display* display = X11Support::display();
+        XWindowAttributes attributes;
+        XGetWindowAttributes(display, X11Support::rootWindow(), &attributes);
+        m_image = XGetImage(display, X11Support::rootWindow(), 0, 0,
+                            attributes.width, attributes.height, AllPlanes, ZPixmap);
+    }
+    ~RootImage() { if (m_image) XDestroyImage(m_image); }
+    RootImage(const RootImage&) = delete;
+    RootImage& operator=(const RootImage&) = delete;
+
+    bool isValid() const { return m_image != nullptr; }
+    unsigned long pixel(const QPoint& pos) const { return XGetPixel(m_image, pos.x(), pos.y()); }
+
+    bool operator==(const RootImage& other) const
+    {
+        return m_image->height == other.m_image->height
+            && m_image->bytes_per_line == other.m_image->bytes_per_line
+            && memcmp(m_image->data, other.m_image->data,
+                      static_cast<size_t>(m_image->bytes_per_line) * m_image->height) == 0;
+    }
+
+private:
+    XImage* m_image = nullptr;
+};
+
+}
+
+class X11XorRendererTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void init();
+    void cleanup();
+
+    void drawInvertsArms();
+    void moveErasesPreviousFrame();
+    void stopRestoresRoot();
+    void settingsChangeRestoresRoot();
+
+private:
+    // A pixel inside an arm, off the one pixel contrast line along its center
+    static QPoint onRightArm(const QPoint& cursor) { return cursor + QPoint(120, 2); }
+    static QPoint onBottomArm(const QPoint& cursor) { return cursor + QPoint(2, 120); }
+    // A pixel between the arms
+    static QPoint offArms(const QPoint& cursor) { return cursor + QPoint(60, 60); }
+
+    CrosshairRenderer::Settings m_settings;
+    X11XorCrosshairRenderer* m_renderer = nullptr;
+    unsigned long m_xorMask = 0;
+};
+
+void X11XorRendererTest::initTestCase()
+{
+    if (!X11Support::isAvailable()) {
+        QSKIP("Needs an X server, run under xvfb-run");
+    }
+
+    // Plain crosshair so every arm pixel is XORed exactly once
+    m_settings.color = Qt::white;
+    m_settings.lineWidth = 8;
+    m_settings.offsetFromCursor = 20;
+    m_settings.showArrows = false;
+    m_settings.solidArms = true;
+
+    Display* display = X11Support::display();
+    m_xorMask = WhitePixel(display, X11Support::defaultScreen());
+}
+
+void X11XorRendererTest::init()
+{
+    m_renderer = new X11XorCrosshairRenderer();
+    QVERIFY(m_renderer->initialize());
+    m_renderer->updateSettings(m_settings);
+}
+
+void X11XorRendererTest::cleanup()
+{
+    delete m_renderer;
+    m_renderer = nullptr;
+}
+
+void X11XorRendererTest::drawInvertsArms()
+{
+    RootImage before;
+    QVERIFY(before.isValid());
+
+    m_renderer->startRendering();
+    m_renderer->updateMousePosition(FirstPos);
+    RootImage drawn;
+
+    QCOMPARE(drawn.pixel(onRightArm(FirstPos)), before.pixel(onRightArm(FirstPos)) ^ m_xorMask);
+    QCOMPARE(drawn.pixel(onBottomArm(FirstPos)), before.pixel(onBottomArm(FirstPos)) ^ m_xorMask);
+    QCOMPARE(drawn.pixel(offArms(FirstPos)), before.pixel(offArms(FirstPos)));
+    // The cursor itself stays clear, the arms start at the offset
+    QCOMPARE(drawn.pixel(FirstPos), before.pixel(FirstPos));
+}
+
+void X11XorRendererTest::moveErasesPreviousFrame()
+{
+    RootImage before;
+    QVERIFY(before.isValid());
+
+    m_renderer->startRendering();
+    m_renderer->updateMousePosition(FirstPos);
+    m_renderer->updateMousePosition(SecondPos);
+    RootImage moved;
+
+    QCOMPARE(moved.pixel(onRightArm(FirstPos)), before.pixel(onRightArm(FirstPos)));
+    QCOMPARE(moved.pixel(onBottomArm(FirstPos)), before.pixel(onBottomArm(FirstPos)));
+    QCOMPARE(moved.pixel(onRightArm(SecondPos)), before.pixel(onRightArm(SecondPos)) ^ m_xorMask);
+    QCOMPARE(moved.pixel(onBottomArm(SecondPos)), before.pixel(onBottomArm(SecondPos)) ^ m_xorMask);
+}
+
+void X11XorRendererTest::stopRestoresRoot()
+{
+    RootImage before;
+    QVERIFY(before.isValid());
+
+    m_renderer->startRendering();
+    m_renderer->updateMousePosition(FirstPos);
+    m_renderer->updateMousePosition(SecondPos);
+    m_renderer->stopRendering();
+
+    RootImage after;
+    QVERIFY(after == before);
+}
+
+void X11XorRendererTest::settingsChangeRestoresRoot()
+{
+    RootImage before;
+    QVERIFY(before.isValid());
+
+    m_renderer->startRendering();
+    m_renderer->updateMousePosition(FirstPos);
+
+    // The old frame is erased with the old colour before the new one is drawn
+    CrosshairRenderer::Settings settings = m_settings;
+    settings.color = Qt::red;
+    settings.lineWidth = 12;
+    m_renderer->updateSettings(settings);
+    m_renderer->stopRendering();
+
+    RootImage after;
+    QVERIFY(after == before);
+}
+
+QTEST_MAIN(X11XorRendererTest)
+#include "tst_x11xorrenderer.moc"
@@ -4,110 +4,116 @@
 <context>
     <name>AboutDialog</name>
     <message>
-        <location filename="../src/AboutDialog.cpp" line="18"/>
+        <location filename="../src/AboutDialog.cpp" line="40"/>
         <source>About MouseCross</source>
         <translation>Über MouseCross</translation>
     </message>
     <message>
-        <location filename="../src/AboutDialog.cpp" line="24"/>
+        <location filename="../src/AboutDialog.cpp" line="44"/>
         <source>About MouseCross Dialog</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/AboutDialog.cpp" line="25"/>
+        <location filename="../src/AboutDialog.cpp" line="45"/>
         <source>Information about MouseCross application including version, description and website link</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/AboutDialog.cpp" line="59"/>
+        <location filename="../src/AboutDialog.cpp" line="73"/>
         <source>MouseCross Application Icon</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/AboutDialog.cpp" line="60"/>
+        <location filename="../src/AboutDialog.cpp" line="74"/>
         <source>MouseCross crosshair logo - a crosshair with circle in center</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/AboutDialog.cpp" line="66"/>
+        <location filename="../src/AboutDialog.cpp" line="80"/>
         <source>MouseCross</source>
         <translation>MouseCross</translation>
     </message>
     <message>
-        <location filename="../src/AboutDialog.cpp" line="72"/>
+        <location filename="../src/AboutDialog.cpp" line="86"/>
         <source>Application Name</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/AboutDialog.cpp" line="73"/>
+        <location filename="../src/AboutDialog.cpp" line="87"/>
         <source>MouseCross - The name of this application</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/AboutDialog.cpp" line="77"/>
+        <location filename="../src/AboutDialog.cpp" line="91"/>
         <source>Version 0.1.0</source>
         <translation>Version 0.1.0</translation>
     </message>
     <message>
-        <location filename="../src/AboutDialog.cpp" line="79"/>
+        <location filename="../src/AboutDialog.cpp" line="93"/>
         <source>Version Information</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/AboutDialog.cpp" line="80"/>
+        <location filename="../src/AboutDialog.cpp" line="94"/>
         <source>Current version of MouseCross application</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/AboutDialog.cpp" line="85"/>
+        <location filename="../src/AboutDialog.cpp" line="99"/>
         <source>A crosshair overlay application designed to help visually impaired users with tunnel vision locate their mouse cursor on the screen.</source>
         <translation>Eine Fadenkreuz-Overlay-Anwendung, die sehbehinderten Benutzern mit Tunnelblick dabei hilft, ihren Mauszeiger auf dem Bildschirm zu finden.</translation>
     </message>
     <message>
-        <location filename="../src/AboutDialog.cpp" line="91"/>
+        <location filename="../src/AboutDialog.cpp" line="104"/>
         <source>Application Description</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/AboutDialog.cpp" line="92"/>
+        <location filename="../src/AboutDialog.cpp" line="105"/>
         <source>Detailed description of MouseCross functionality and target users</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/AboutDialog.cpp" line="99"/>
-        <source>© 2024 MouseCross
-Built with Qt %1
+        <location filename="../src/AboutDialog.cpp" line="112"/>
+        <source>© 2025 Stefan Lohmaier
+Licensed under LGPL-3.0-or-later
+Built with Qt %1 (LGPL)
 
-Visit: &lt;a href=&quot;https://slohmaier.de/MouseCross&quot;&gt;https://slohmaier.de/MouseCross&lt;/a&gt;</source>
+This program is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+
+Visit: &lt;a href=&quot;https://slohmaier.de/mousecross&quot;&gt;https://slohmaier.de/mousecross&lt;/a&gt;
+License: &lt;a href=&quot;https://www.gnu.org/licenses/lgpl-3.0.html&quot;&gt;LGPL-3.0&lt;/a&gt;</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/AboutDialog.cpp" line="106"/>
+        <location filename="../src/AboutDialog.cpp" line="124"/>
         <source>Copyright and Website Information</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/AboutDialog.cpp" line="107"/>
+        <location filename="../src/AboutDialog.cpp" line="125"/>
         <source>Copyright notice, Qt version information, and website link to MouseCross project page</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/AboutDialog.cpp" line="108"/>
+        <location filename="../src/AboutDialog.cpp" line="126"/>
         <source>Click the website link to visit the MouseCross project page</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/AboutDialog.cpp" line="125"/>
+        <location filename="../src/AboutDialog.cpp" line="140"/>
         <source>Close Dialog</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/AboutDialog.cpp" line="126"/>
+        <location filename="../src/AboutDialog.cpp" line="141"/>
         <source>Closes the About dialog and returns to the application</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/AboutDialog.cpp" line="127"/>
+        <location filename="../src/AboutDialog.cpp" line="142"/>
         <source>Close this dialog</source>
         <translation type="unfinished"></translation>
     </message>
@@ -122,27 +128,27 @@ Erstellt mit Qt %1
 https://slohmaier.de/MouseCross</translation>
     </message>
     <message>
-        <location filename="../src/AboutDialog.cpp" line="117"/>
+        <location filename="../src/AboutDialog.cpp" line="132"/>
         <source>Show Welcome</source>
         <translation>Willkommen anzeigen</translation>
     </message>
     <message>
-        <location filename="../src/AboutDialog.cpp" line="118"/>
+        <location filename="../src/AboutDialog.cpp" line="133"/>
         <source>Show Welcome Dialog</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/AboutDialog.cpp" line="119"/>
+        <location filename="../src/AboutDialog.cpp" line="134"/>
         <source>Opens the welcome dialog with application introduction and quick setup</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/AboutDialog.cpp" line="120"/>
+        <location filename="../src/AboutDialog.cpp" line="135"/>
         <source>Click to show the welcome dialog with application overview</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/AboutDialog.cpp" line="123"/>
+        <location filename="../src/AboutDialog.cpp" line="138"/>
         <source>OK</source>
         <translation>OK</translation>
     </message>
@@ -150,417 +156,450 @@ https://slohmaier.de/MouseCross</translation>
 <context>
     <name>MouseCrossApp</name>
     <message>
-        <location filename="../src/MouseCrossApp.cpp" line="60"/>
-        <location filename="../src/MouseCrossApp.cpp" line="208"/>
-        <location filename="../src/MouseCrossApp.cpp" line="214"/>
+        <location filename="../src/MouseCrossApp.cpp" line="102"/>
+        <location filename="../src/MouseCrossApp.cpp" line="371"/>
+        <location filename="../src/MouseCrossApp.cpp" line="377"/>
         <source>MouseCross</source>
         <translation>MouseCross</translation>
     </message>
     <message>
-        <location filename="../src/MouseCrossApp.cpp" line="61"/>
+        <location filename="../src/MouseCrossApp.cpp" line="103"/>
         <source>System tray is not available on this system</source>
         <translation>Die Systemleiste ist auf diesem System nicht verfügbar</translation>
     </message>
     <message>
-        <location filename="../src/MouseCrossApp.cpp" line="86"/>
+        <location filename="../src/MouseCrossApp.cpp" line="237"/>
         <source>&amp;Toggle Crosshair</source>
         <translation>&amp;Fadenkreuz umschalten</translation>
     </message>
     <message>
-        <location filename="../src/MouseCrossApp.cpp" line="87"/>
+        <location filename="../src/MouseCrossApp.cpp" line="238"/>
         <source>Show or hide the crosshair overlay</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/MouseCrossApp.cpp" line="88"/>
+        <location filename="../src/MouseCrossApp.cpp" line="239"/>
         <source>Toggle crosshair visibility on or off</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/MouseCrossApp.cpp" line="91"/>
+        <location filename="../src/MouseCrossApp.cpp" line="242"/>
         <source>&amp;Settings...</source>
         <translation>&amp;Einstellungen...</translation>
     </message>
     <message>
-        <location filename="../src/MouseCrossApp.cpp" line="92"/>
+        <location filename="../src/MouseCrossApp.cpp" line="243"/>
         <source>Open settings dialog to configure crosshair appearance and behavior</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/MouseCrossApp.cpp" line="93"/>
+        <location filename="../src/MouseCrossApp.cpp" line="244"/>
         <source>Configure MouseCross settings and preferences</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/MouseCrossApp.cpp" line="96"/>
+        <location filename="../src/MouseCrossApp.cpp" line="247"/>
         <source>&amp;About...</source>
         <translation>&amp;Über...</translation>
     </message>
     <message>
-        <location filename="../src/MouseCrossApp.cpp" line="97"/>
+        <location filename="../src/MouseCrossApp.cpp" line="248"/>
         <source>Show information about MouseCross application</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/MouseCrossApp.cpp" line="98"/>
+        <location filename="../src/MouseCrossApp.cpp" line="249"/>
         <source>Display version and information about MouseCross</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/MouseCrossApp.cpp" line="101"/>
+        <location filename="../src/MouseCrossApp.cpp" line="252"/>
         <source>&amp;Quit</source>
         <translation>&amp;Beenden</translation>
     </message>
     <message>
-        <location filename="../src/MouseCrossApp.cpp" line="102"/>
+        <location filename="../src/MouseCrossApp.cpp" line="253"/>
         <source>Exit MouseCross application completely</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/MouseCrossApp.cpp" line="103"/>
+        <location filename="../src/MouseCrossApp.cpp" line="254"/>
         <source>Close MouseCross and remove from system tray</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/MouseCrossApp.cpp" line="110"/>
+        <location filename="../src/MouseCrossApp.cpp" line="299"/>
         <source>MouseCross System Tray Menu</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/MouseCrossApp.cpp" line="111"/>
+        <location filename="../src/MouseCrossApp.cpp" line="300"/>
         <source>Context menu for MouseCross system tray icon with application controls</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/MouseCrossApp.cpp" line="151"/>
+        <location filename="../src/MouseCrossApp.cpp" line="309"/>
         <source>MouseCross - Visual Mouse Locator</source>
         <translation>MouseCross - Visueller Mauszeiger-Finder</translation>
     </message>
     <message>
-        <location filename="../src/MouseCrossApp.cpp" line="207"/>
+        <location filename="../src/MouseCrossApp.cpp" line="370"/>
         <source>&amp;Hide Crosshair</source>
         <translation>&amp;Fadenkreuz ausblenden</translation>
     </message>
     <message>
-        <location filename="../src/MouseCrossApp.cpp" line="209"/>
+        <location filename="../src/MouseCrossApp.cpp" line="372"/>
         <source>Crosshair activated</source>
         <translation>Fadenkreuz aktiviert</translation>
     </message>
     <message>
-        <location filename="../src/MouseCrossApp.cpp" line="213"/>
+        <location filename="../src/MouseCrossApp.cpp" line="376"/>
         <source>&amp;Show Crosshair</source>
         <translation>&amp;Fadenkreuz einblenden</translation>
     </message>
     <message>
-        <location filename="../src/MouseCrossApp.cpp" line="215"/>
+        <location filename="../src/MouseCrossApp.cpp" line="378"/>
         <source>Crosshair deactivated</source>
         <translation>Fadenkreuz deaktiviert</translation>
     </message>
 </context>
+<context>
+    <name>QObject</name>
+    <message>
+        <location filename="../src/RendererRegistry.cpp" line="183"/>
+        <source>Native overlay</source>
+        <translation>Natives Overlay</translation>
+    </message>
+    <message>
+        <location filename="../src/RendererRegistry.cpp" line="185"/>
+        <source>Qt overlay window</source>
+        <translation>Qt-Overlay-Fenster</translation>
+    </message>
+    <message>
+        <location filename="../src/RendererRegistry.cpp" line="190"/>
+        <source>Wayland layer shell</source>
+        <translation>Wayland Layer Shell</translation>
+    </message>
+    <message>
+        <location filename="../src/RendererRegistry.cpp" line="196"/>
+        <source>X11 XRender</source>
+        <translation>X11 XRender</translation>
+    </message>
+    <message>
+        <location filename="../src/RendererRegistry.cpp" line="201"/>
+        <source>X11 XOR (no compositor)</source>
+        <translation>X11 XOR (ohne Compositor)</translation>
+    </message>
+    <message>
+        <location filename="../src/RendererRegistry.cpp" line="206"/>
+        <source>Qt Quick scene graph</source>
+        <translation>Qt-Quick-Szenengraph</translation>
+    </message>
+</context>
 <context>
     <name>SettingsDialog</name>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="227"/>
+        <location filename="../src/SettingsDialog.cpp" line="254"/>
         <source>MouseCross Settings</source>
         <translation>MouseCross-Einstellungen</translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="235"/>
+        <location filename="../src/SettingsDialog.cpp" line="262"/>
         <source>MouseCross Settings Dialog</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="236"/>
+        <location filename="../src/SettingsDialog.cpp" line="263"/>
         <source>Configure MouseCross crosshair appearance, behavior and keyboard shortcuts</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="258"/>
+        <location filename="../src/SettingsDialog.cpp" line="285"/>
         <source>Restore Defaults</source>
         <translation>Standardwerte wiederherstellen</translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="259"/>
+        <location filename="../src/SettingsDialog.cpp" line="286"/>
         <source>Restore Default Settings</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="260"/>
+        <location filename="../src/SettingsDialog.cpp" line="287"/>
         <source>Reset all settings to their original default values</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="261"/>
+        <location filename="../src/SettingsDialog.cpp" line="288"/>
         <source>Click to reset all crosshair settings to default values</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="264"/>
+        <location filename="../src/SettingsDialog.cpp" line="291"/>
         <source>Close</source>
         <translation>Schließen</translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="266"/>
+        <location filename="../src/SettingsDialog.cpp" line="293"/>
         <source>Close Settings Dialog</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="267"/>
+        <location filename="../src/SettingsDialog.cpp" line="294"/>
         <source>Close the settings dialog and save current settings</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="268"/>
+        <location filename="../src/SettingsDialog.cpp" line="295"/>
         <source>Close settings dialog - changes are saved automatically</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="294"/>
+        <location filename="../src/SettingsDialog.cpp" line="328"/>
         <source>Crosshair Appearance</source>
         <translation>Fadenkreuz-Aussehen</translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="295"/>
+        <location filename="../src/SettingsDialog.cpp" line="329"/>
         <source>Crosshair Appearance Settings</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="296"/>
+        <location filename="../src/SettingsDialog.cpp" line="330"/>
         <source>Configure visual properties of the crosshair overlay</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="308"/>
+        <location filename="../src/SettingsDialog.cpp" line="342"/>
         <source>Line Width:</source>
         <translation>Linienbreite:</translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="313"/>
+        <location filename="../src/SettingsDialog.cpp" line="347"/>
         <source>Base thickness (automatically scaled for high DPI displays)</source>
         <translation>Grunddicke (automatisch für hochauflösende Bildschirme skaliert)</translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="314"/>
+        <location filename="../src/SettingsDialog.cpp" line="348"/>
         <source>Line Width</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="315"/>
+        <location filename="../src/SettingsDialog.cpp" line="349"/>
         <source>Set the base thickness of crosshair lines in pixels</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="321"/>
+        <location filename="../src/SettingsDialog.cpp" line="355"/>
         <source>Offset from Cursor:</source>
         <translation>Abstand zum Zeiger:</translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="326"/>
+        <location filename="../src/SettingsDialog.cpp" line="360"/>
         <source>Distance from mouse cursor where lines start</source>
         <translation>Entfernung vom Mauszeiger, wo die Linien beginnen</translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="327"/>
+        <location filename="../src/SettingsDialog.cpp" line="361"/>
         <source>Cursor Offset</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="328"/>
+        <location filename="../src/SettingsDialog.cpp" line="362"/>
         <source>Distance in pixels from mouse cursor where crosshair lines begin</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="334"/>
+        <location filename="../src/SettingsDialog.cpp" line="368"/>
         <source>Thickness Growth:</source>
         <translation>Dicken-Zunahme:</translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="339"/>
+        <location filename="../src/SettingsDialog.cpp" line="373"/>
         <source>Thickness Growth Factor</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="340"/>
+        <location filename="../src/SettingsDialog.cpp" line="374"/>
         <source>How much thicker the crosshair lines become towards the edges</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="341"/>
+        <location filename="../src/SettingsDialog.cpp" line="375"/>
         <source>Controls how much the crosshair lines thicken from center to edges</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="344"/>
+        <location filename="../src/SettingsDialog.cpp" line="378"/>
         <source>Current Thickness Multiplier</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="356"/>
+        <location filename="../src/SettingsDialog.cpp" line="390"/>
         <source>Opacity:</source>
         <translation>Deckkraft:</translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="361"/>
+        <location filename="../src/SettingsDialog.cpp" line="395"/>
         <source>Crosshair Opacity</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="362"/>
+        <location filename="../src/SettingsDialog.cpp" line="396"/>
         <source>Transparency level of the crosshair overlay</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="363"/>
+        <location filename="../src/SettingsDialog.cpp" line="397"/>
         <source>Adjust how transparent or opaque the crosshair appears</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="366"/>
+        <location filename="../src/SettingsDialog.cpp" line="400"/>
         <source>Current Opacity Percentage</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="377"/>
+        <location filename="../src/SettingsDialog.cpp" line="411"/>
         <source>Color:</source>
         <translation>Farbe:</translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="381"/>
+        <location filename="../src/SettingsDialog.cpp" line="415"/>
         <source>Crosshair Color</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="382"/>
+        <location filename="../src/SettingsDialog.cpp" line="416"/>
         <source>Choose the color for the crosshair lines</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="383"/>
+        <location filename="../src/SettingsDialog.cpp" line="417"/>
         <source>Click to open color picker and select crosshair color</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="389"/>
+        <location filename="../src/SettingsDialog.cpp" line="423"/>
         <source>Show direction shapes along crosshair</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="390"/>
+        <location filename="../src/SettingsDialog.cpp" line="424"/>
         <source>Show Direction Shapes</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="391"/>
+        <location filename="../src/SettingsDialog.cpp" line="425"/>
         <source>Display direction shapes along the crosshair lines</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="392"/>
+        <location filename="../src/SettingsDialog.cpp" line="426"/>
         <source>Add visual direction indicators along the crosshair lines</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="397"/>
+        <location filename="../src/SettingsDialog.cpp" line="431"/>
         <source>Shape Spacing Growth:</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="402"/>
+        <location filename="../src/SettingsDialog.cpp" line="436"/>
         <source>Shape Spacing Growth Rate</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="403"/>
+        <location filename="../src/SettingsDialog.cpp" line="437"/>
         <source>How much shape spacing increases from center to edges</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="404"/>
+        <location filename="../src/SettingsDialog.cpp" line="438"/>
         <source>Controls the rate at which shape spacing grows from cursor center to screen edges</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="407"/>
+        <location filename="../src/SettingsDialog.cpp" line="441"/>
         <source>Current Spacing Growth Percentage</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="418"/>
+        <location filename="../src/SettingsDialog.cpp" line="452"/>
         <source>Direction Shape:</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="421"/>
+        <location filename="../src/SettingsDialog.cpp" line="455"/>
         <source>Circle</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="422"/>
+        <location filename="../src/SettingsDialog.cpp" line="456"/>
         <source>Arrow (to center)</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="423"/>
+        <location filename="../src/SettingsDialog.cpp" line="457"/>
         <source>Cross</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="424"/>
+        <location filename="../src/SettingsDialog.cpp" line="458"/>
         <source>Raute</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="425"/>
+        <location filename="../src/SettingsDialog.cpp" line="459"/>
         <source>Direction Shape</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="426"/>
+        <location filename="../src/SettingsDialog.cpp" line="460"/>
         <source>Choose the shape drawn along crosshair lines</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="427"/>
+        <location filename="../src/SettingsDialog.cpp" line="461"/>
         <source>Select the type of shape to display along the crosshair lines</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="441"/>
+        <location filename="../src/SettingsDialog.cpp" line="475"/>
         <source>Application Behavior Settings</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="442"/>
+        <location filename="../src/SettingsDialog.cpp" line="476"/>
         <source>Configure how MouseCross behaves when starting and running</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="446"/>
+        <location filename="../src/SettingsDialog.cpp" line="480"/>
         <source>Start with Windows</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="448"/>
+        <location filename="../src/SettingsDialog.cpp" line="482"/>
         <source>Start with macOS</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="450"/>
+        <location filename="../src/SettingsDialog.cpp" line="484"/>
         <source>Start with system</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="452"/>
+        <location filename="../src/SettingsDialog.cpp" line="486"/>
         <source>Auto-start with System</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="453"/>
+        <location filename="../src/SettingsDialog.cpp" line="487"/>
         <source>Automatically start MouseCross when the operating system boots</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="454"/>
+        <location filename="../src/SettingsDialog.cpp" line="488"/>
         <source>MouseCross will start automatically when you log in to your computer</source>
         <translation type="unfinished"></translation>
     </message>
@@ -569,7 +608,7 @@ https://slohmaier.de/MouseCross</translation>
         <translation type="vanished">Richtungspfeile auf innerer Linie anzeigen</translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="440"/>
+        <location filename="../src/SettingsDialog.cpp" line="474"/>
         <source>Behavior</source>
         <translation>Verhalten</translation>
     </message>
@@ -578,62 +617,217 @@ https://slohmaier.de/MouseCross</translation>
         <translation type="vanished">Mit Windows/macOS starten</translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="458"/>
+        <location filename="../src/SettingsDialog.cpp" line="492"/>
         <source>Activate crosshair on application start</source>
         <translation>Fadenkreuz beim Programmstart aktivieren</translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="459"/>
+        <location filename="../src/SettingsDialog.cpp" line="493"/>
         <source>Activate on Start</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="460"/>
+        <location filename="../src/SettingsDialog.cpp" line="494"/>
         <source>Show crosshair immediately when MouseCross application starts</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="461"/>
+        <location filename="../src/SettingsDialog.cpp" line="495"/>
         <source>The crosshair will be visible as soon as MouseCross starts</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="468"/>
+        <location filename="../src/SettingsDialog.cpp" line="499"/>
+        <source>Predict fast cursor movement</source>
+        <translation>Schnelle Mausbewegungen vorausberechnen</translation>
+    </message>
+    <message>
+        <location filename="../src/SettingsDialog.cpp" line="500"/>
+        <source>Motion Prediction</source>
+        <translation>Bewegungsvorhersage</translation>
+    </message>
+    <message>
+        <location filename="../src/SettingsDialog.cpp" line="501"/>
+        <source>Draw the crosshair slightly ahead of a fast moving cursor so it does not trail behind</source>
+        <translation>Das Fadenkreuz bei schnellen Mausbewegungen etwas vorauszeichnen, damit es nicht hinterherhinkt</translation>
+    </message>
+    <message>
+        <location filename="../src/SettingsDialog.cpp" line="502"/>
+        <source>Reduces the lag of the crosshair behind a fast cursor; paused during sharp direction changes</source>
+        <translation>Verringert die Verzögerung des Fadenkreuzes hinter einem schnellen Mauszeiger; bei scharfen Richtungswechseln ausgesetzt</translation>
+    </message>
+    <message>
+        <location filename="../src/SettingsDialog.cpp" line="506"/>
+        <source>Hide over fullscreen applications and locked screens</source>
+        <translation>Über Vollbildanwendungen und gesperrtem Bildschirm ausblenden</translation>
+    </message>
+    <message>
+        <location filename="../src/SettingsDialog.cpp" line="507"/>
+        <source>Automatic Suspend</source>
+        <translation>Automatisches Pausieren</translation>
+    </message>
+    <message>
+        <location filename="../src/SettingsDialog.cpp" line="508"/>
+        <source>Pause the crosshair while a fullscreen application is active, an application hides the cursor or the screen is locked</source>
+        <translation>Das Fadenkreuz pausieren, solange eine Vollbildanwendung aktiv ist, eine Anwendung den Mauszeiger ausblendet oder der Bildschirm gesperrt ist</translation>
+    </message>
+    <message>
+        <location filename="../src/SettingsDialog.cpp" line="509"/>
+        <source>The crosshair comes back as soon as the fullscreen application, hidden cursor or lock screen is gone</source>
+        <translation>Das Fadenkreuz erscheint wieder, sobald Vollbildanwendung, ausgeblendeter Mauszeiger oder Sperrbildschirm verschwunden sind</translation>
+    </message>
+    <message>
+        <location filename="../src/SettingsDialog.cpp" line="513"/>
+        <source>Save power on battery</source>
+        <translation>Im Akkubetrieb Energie sparen</translation>
+    </message>
+    <message>
+        <location filename="../src/SettingsDialog.cpp" line="514"/>
+        <source>Low Power Profile</source>
+        <translation>Energiesparprofil</translation>
+    </message>
+    <message>
+        <location filename="../src/SettingsDialog.cpp" line="515"/>
+        <source>Lower the frame rate and simplify the crosshair while the computer runs on battery</source>
+        <translation>Bildrate senken und das Fadenkreuz vereinfachen, solange der Computer im Akkubetrieb läuft</translation>
+    </message>
+    <message>
+        <location filename="../src/SettingsDialog.cpp" line="516"/>
+        <source>On battery the crosshair updates less often and is drawn without direction shapes and smoothing</source>
+        <translation>Im Akkubetrieb wird das Fadenkreuz seltener aktualisiert und ohne Richtungsformen und Kantenglättung gezeichnet</translation>
+    </message>
+    <message>
+        <location filename="../src/SettingsDialog.cpp" line="521"/>
+        <source>Hide when the mouse rests for:</source>
+        <translation>Ausblenden, wenn die Maus ruht für:</translation>
+    </message>
+    <message>
+        <location filename="../src/SettingsDialog.cpp" line="525"/>
+        <source> s</source>
+        <translation> s</translation>
+    </message>
+    <message>
+        <location filename="../src/SettingsDialog.cpp" line="526"/>
+        <source>Never</source>
+        <translation>Nie</translation>
+    </message>
+    <message>
+        <location filename="../src/SettingsDialog.cpp" line="527"/>
+        <source>Auto-hide Delay</source>
+        <translation>Verzögerung für automatisches Ausblenden</translation>
+    </message>
+    <message>
+        <location filename="../src/SettingsDialog.cpp" line="528"/>
+        <source>Seconds without mouse movement before the crosshair is hidden, it returns on the next movement</source>
+        <translation>Sekunden ohne Mausbewegung, bevor das Fadenkreuz ausgeblendet wird; es erscheint bei der nächsten Bewegung wieder</translation>
+    </message>
+    <message>
+        <location filename="../src/SettingsDialog.cpp" line="529"/>
+        <source>The crosshair reappears as soon as the mouse moves</source>
+        <translation>Das Fadenkreuz erscheint wieder, sobald die Maus bewegt wird</translation>
+    </message>
+    <message>
+        <location filename="../src/SettingsDialog.cpp" line="535"/>
+        <source>Show the crosshair only when the mouse is shaken</source>
+        <translation>Fadenkreuz nur beim Schütteln der Maus anzeigen</translation>
+    </message>
+    <message>
+        <location filename="../src/SettingsDialog.cpp" line="536"/>
+        <source>Shake to Locate</source>
+        <translation>Schütteln zum Finden</translation>
+    </message>
+    <message>
+        <location filename="../src/SettingsDialog.cpp" line="537"/>
+        <source>Keep the crosshair hidden until the mouse is moved quickly back and forth</source>
+        <translation>Das Fadenkreuz ausgeblendet lassen, bis die Maus schnell hin und her bewegt wird</translation>
+    </message>
+    <message>
+        <location filename="../src/SettingsDialog.cpp" line="538"/>
+        <source>Shake the mouse to show the crosshair, it hides again a few seconds after the mouse rests</source>
+        <translation>Die Maus schütteln, um das Fadenkreuz anzuzeigen; es verschwindet wieder einige Sekunden, nachdem die Maus ruht</translation>
+    </message>
+    <message>
+        <location filename="../src/SettingsDialog.cpp" line="543"/>
+        <source>Renderer:</source>
+        <translation>Renderer:</translation>
+    </message>
+    <message>
+        <location filename="../src/SettingsDialog.cpp" line="546"/>
+        <source>Renderer Backend</source>
+        <translation>Renderer-Backend</translation>
+    </message>
+    <message>
+        <location filename="../src/SettingsDialog.cpp" line="547"/>
+        <source>Drawing method used for the crosshair overlay</source>
+        <translation>Zeichenverfahren für das Fadenkreuz-Overlay</translation>
+    </message>
+    <message>
+        <location filename="../src/SettingsDialog.cpp" line="548"/>
+        <source>Automatic uses the fastest renderer measured on this computer</source>
+        <translation>Automatisch verwendet den Renderer, der auf diesem Computer am schnellsten gemessen wurde</translation>
+    </message>
+    <message>
+        <location filename="../src/SettingsDialog.cpp" line="549"/>
+        <source>Automatic</source>
+        <translation>Automatisch</translation>
+    </message>
+    <message>
+        <location filename="../src/SettingsDialog.cpp" line="566"/>
         <source>Hotkey</source>
         <translation>Tastenkürzel</translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="469"/>
+        <location filename="../src/SettingsDialog.cpp" line="567"/>
         <source>Keyboard Shortcut Settings</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="470"/>
+        <location filename="../src/SettingsDialog.cpp" line="568"/>
         <source>Configure keyboard shortcut to toggle crosshair visibility</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="473"/>
+        <location filename="../src/SettingsDialog.cpp" line="571"/>
         <source>Toggle hotkey:</source>
         <translation>Fadenkreuz ein-/ausblenden:</translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="476"/>
+        <location filename="../src/SettingsDialog.cpp" line="574"/>
         <source>Toggle Hotkey</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="477"/>
+        <location filename="../src/SettingsDialog.cpp" line="575"/>
         <source>Keyboard combination to show or hide the crosshair</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="478"/>
+        <location filename="../src/SettingsDialog.cpp" line="576"/>
         <source>Press keys to set hotkey combination for toggling crosshair visibility</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/SettingsDialog.cpp" line="509"/>
+        <location filename="../src/SettingsDialog.cpp" line="581"/>
+        <source>Show only while &amp;held</source>
+        <translation>Nur &amp;während des Haltens anzeigen</translation>
+    </message>
+    <message>
+        <location filename="../src/SettingsDialog.cpp" line="582"/>
+        <source>Show only while held</source>
+        <translation>Nur während des Haltens anzeigen</translation>
+    </message>
+    <message>
+        <location filename="../src/SettingsDialog.cpp" line="583"/>
+        <source>Show the crosshair while the hotkey is held down and hide it on release</source>
+        <translation>Das Fadenkreuz anzeigen, solange das Tastenkürzel gedrückt wird, und beim Loslassen ausblenden</translation>
+    </message>
+    <message>
+        <location filename="../src/SettingsDialog.cpp" line="584"/>
+        <source>Hold the hotkey to show the crosshair, release it to hide the crosshair again</source>
+        <translation>Tastenkürzel gedrückt halten, um das Fadenkreuz anzuzeigen, loslassen, um es wieder auszublenden</translation>
+    </message>
+    <message>
+        <location filename="../src/SettingsDialog.cpp" line="630"/>
         <source>Select Crosshair Color</source>
         <translation>Fadenkreuz-Farbe auswählen</translation>
     </message>
@@ -641,78 +835,88 @@ https://slohmaier.de/MouseCross</translation>
 <context>
     <name>WelcomeDialog</name>
     <message>
-        <location filename="../src/WelcomeDialog.cpp" line="16"/>
-        <location filename="../src/WelcomeDialog.cpp" line="32"/>
+        <location filename="../src/WelcomeDialog.cpp" line="40"/>
+        <location filename="../src/WelcomeDialog.cpp" line="86"/>
         <source>Welcome to MouseCross</source>
         <translation>Willkommen bei MouseCross</translation>
     </message>
     <message>
-        <location filename="../src/WelcomeDialog.cpp" line="21"/>
+        <location filename="../src/WelcomeDialog.cpp" line="45"/>
         <source>MouseCross Welcome Dialog</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/WelcomeDialog.cpp" line="22"/>
+        <location filename="../src/WelcomeDialog.cpp" line="46"/>
         <source>Introduction to MouseCross features and initial setup options</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/WelcomeDialog.cpp" line="38"/>
+        <location filename="../src/WelcomeDialog.cpp" line="79"/>
+        <source>MouseCross Application Icon</source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../src/WelcomeDialog.cpp" line="80"/>
+        <source>MouseCross crosshair logo - a crosshair with rounded rectangle</source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../src/WelcomeDialog.cpp" line="92"/>
         <source>Welcome Title</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/WelcomeDialog.cpp" line="39"/>
+        <location filename="../src/WelcomeDialog.cpp" line="93"/>
         <source>Welcome message for new MouseCross users</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/WelcomeDialog.cpp" line="44"/>
+        <location filename="../src/WelcomeDialog.cpp" line="98"/>
         <source>MouseCross helps visually impaired users locate their mouse cursor by displaying a customizable crosshair overlay.</source>
         <translation>MouseCross hilft sehbehinderten Benutzern dabei, ihren Mauszeiger zu finden, indem es ein anpassbares Fadenkreuz-Overlay anzeigt.</translation>
     </message>
     <message>
-        <location filename="../src/WelcomeDialog.cpp" line="48"/>
+        <location filename="../src/WelcomeDialog.cpp" line="102"/>
         <source>Application Description</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/WelcomeDialog.cpp" line="49"/>
+        <location filename="../src/WelcomeDialog.cpp" line="103"/>
         <source>Brief description of MouseCross purpose and functionality</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/WelcomeDialog.cpp" line="54"/>
+        <location filename="../src/WelcomeDialog.cpp" line="108"/>
         <source>Key features:&lt;br/&gt;• Always-on-top crosshair overlay&lt;br/&gt;• Customizable appearance and size&lt;br/&gt;• Inverted mode for visibility on any background&lt;br/&gt;• Default hotkey: &lt;b&gt;⌘⌥⇧C&lt;/b&gt; (Cmd+Option+Shift+C)&lt;br/&gt;• Default hotkey: &lt;b&gt;Ctrl+Alt+Shift+C&lt;/b&gt;&lt;br/&gt;• Auto-start with Windows&lt;br/&gt;&lt;br/&gt;• Auto-start with macOS&lt;br/&gt;&lt;br/&gt;• Auto-start with system&lt;br/&gt;&lt;br/&gt;The application runs from the system tray. Double-click the tray icon to toggle the crosshair.&lt;br/&gt;&lt;br/&gt;More information: &lt;a href=&quot;https://slohmaier.de/MouseCross&quot;&gt;https://slohmaier.de/MouseCross&lt;/a&gt;</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/WelcomeDialog.cpp" line="77"/>
+        <location filename="../src/WelcomeDialog.cpp" line="131"/>
         <source>Feature List and Instructions</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/WelcomeDialog.cpp" line="78"/>
+        <location filename="../src/WelcomeDialog.cpp" line="132"/>
         <source>Detailed list of MouseCross features and usage instructions</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/WelcomeDialog.cpp" line="79"/>
+        <location filename="../src/WelcomeDialog.cpp" line="133"/>
         <source>Overview of key features and how to use MouseCross</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/WelcomeDialog.cpp" line="103"/>
+        <location filename="../src/WelcomeDialog.cpp" line="157"/>
         <source>Close Welcome Dialog</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/WelcomeDialog.cpp" line="104"/>
+        <location filename="../src/WelcomeDialog.cpp" line="158"/>
         <source>Close the welcome dialog and start using MouseCross</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/WelcomeDialog.cpp" line="105"/>
+        <location filename="../src/WelcomeDialog.cpp" line="159"/>
         <source>Close welcome dialog and begin using MouseCross</source>
         <translation type="unfinished"></translation>
     </message>
@@ -739,47 +943,47 @@ Die Anwendung läuft über die Systemleiste. Doppelklicken Sie auf das Symbol in
 Weitere Informationen: https://slohmaier.de/MouseCross</translation>
     </message>
     <message>
-        <location filename="../src/WelcomeDialog.cpp" line="85"/>
+        <location filename="../src/WelcomeDialog.cpp" line="139"/>
         <source>Don&apos;t show this welcome screen again</source>
         <translation>Diesen Willkommensbildschirm nicht mehr anzeigen</translation>
     </message>
     <message>
-        <location filename="../src/WelcomeDialog.cpp" line="87"/>
+        <location filename="../src/WelcomeDialog.cpp" line="141"/>
         <source>Don&apos;t Show Welcome Again</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/WelcomeDialog.cpp" line="88"/>
+        <location filename="../src/WelcomeDialog.cpp" line="142"/>
         <source>Skip showing this welcome dialog on future application starts</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/WelcomeDialog.cpp" line="89"/>
+        <location filename="../src/WelcomeDialog.cpp" line="143"/>
         <source>Check this to skip the welcome screen when MouseCross starts</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/WelcomeDialog.cpp" line="95"/>
+        <location filename="../src/WelcomeDialog.cpp" line="149"/>
         <source>Open Settings</source>
         <translation>Einstellungen öffnen</translation>
     </message>
     <message>
-        <location filename="../src/WelcomeDialog.cpp" line="96"/>
+        <location filename="../src/WelcomeDialog.cpp" line="150"/>
         <source>Open Settings Dialog</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/WelcomeDialog.cpp" line="97"/>
+        <location filename="../src/WelcomeDialog.cpp" line="151"/>
         <source>Open the settings dialog to configure crosshair appearance and behavior</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/WelcomeDialog.cpp" line="98"/>
+        <location filename="../src/WelcomeDialog.cpp" line="152"/>
         <source>Click to configure MouseCross settings</source>
         <translation type="unfinished"></translation>
     </message>
     <message>
-        <location filename="../src/WelcomeDialog.cpp" line="101"/>
+        <location filename="../src/WelcomeDialog.cpp" line="155"/>
         <source>OK</source>
         <translation>OK</translation>
     </message>